@@ -0,0 +1,121 @@
+// Measures msgpack::read with the default Reader, which goes through
+// msgpack_unpack(...), against the OnDemandReader on large and small
+// documents. msgpack_unpack(...) on its own is the lower bound for the
+// default Reader.
+//
+// Build with -DLEARN_REFLECT_CPP_BUILD_BENCHMARKS=ON and -O2 or higher.
+
+#include <msgpack.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Address {
+  std::string street;
+  std::string city;
+  int zip;
+};
+
+struct Person {
+  std::string first_name;
+  std::string last_name;
+  int age;
+  double salary;
+  bool active;
+  std::vector<std::string> tags;
+  Address address;
+  std::optional<std::string> nickname;
+};
+
+/// Only a subset of Person, so the remaining fields need to be skipped.
+struct PersonName {
+  std::string first_name;
+  std::string last_name;
+};
+
+std::vector<Person> make_people(const size_t _n) {
+  std::vector<Person> people;
+  people.reserve(_n);
+  for (size_t i = 0; i < _n; ++i) {
+    people.push_back(
+        Person{.first_name = "Homer " + std::to_string(i),
+               .last_name = "Simpson \"The Man\"",
+               .age = static_cast<int>(i % 90),
+               .salary = 1234.5678 * static_cast<double>(i),
+               .active = i % 2 == 0,
+               .tags = {"nuclear", "safety", "inspector", "sector 7G"},
+               .address = Address{.street = "742 Evergreen Terrace",
+                                  .city = "Springfield",
+                                  .zip = 58008},
+               .nickname = i % 3 == 0 ? std::optional<std::string>("Homie")
+                                      : std::nullopt});
+  }
+  return people;
+}
+
+/// Calls _f _iterations times and prints the throughput.
+template <class F>
+void run(const char* _label, const std::vector<char>& _bytes,
+         const size_t _iterations, const F& _f) {
+  const auto begin = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < _iterations; ++i) {
+    if (!_f()) {
+      std::fprintf(stderr, "%s: Reading failed.\n", _label);
+      std::exit(1);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto seconds = std::chrono::duration<double>(end - begin).count();
+  const auto mb = static_cast<double>(_bytes.size() * _iterations) / 1e6;
+  std::printf("%-20s %12.2f us/iter %10.1f MB/s\n", _label,
+              seconds * 1e6 / static_cast<double>(_iterations), mb / seconds);
+}
+
+/// Only unpacks _bytes into a msgpack_object, which the default Reader
+/// always has to do before it can read anything.
+bool unpack_only(const std::vector<char>& _bytes) {
+  msgpack_zone mempool;
+  msgpack_zone_init(&mempool, 2048);
+  msgpack_object deserialized;
+  const auto ret = msgpack_unpack(_bytes.data(), _bytes.size(), NULL,
+                                  &mempool, &deserialized);
+  msgpack_zone_destroy(&mempool);
+  return ret == MSGPACK_UNPACK_SUCCESS;
+}
+
+template <class T>
+void compare(const char* _name, const std::vector<char>& _bytes,
+             const size_t _iterations) {
+  std::printf("\n%s (%zu bytes, %zu iterations)\n", _name, _bytes.size(),
+              _iterations);
+  run("msgpack_unpack only", _bytes, _iterations,
+      [&]() { return unpack_only(_bytes); });
+  run("Reader", _bytes, _iterations,
+      [&]() { return bool(rfl::msgpack::read<T>(_bytes)); });
+  run("OnDemandReader", _bytes, _iterations, [&]() {
+    return bool(rfl::msgpack::read<T, rfl::msgpack::OnDemand>(_bytes));
+  });
+}
+
+}  // namespace
+
+int main() {
+  const auto large = rfl::msgpack::write(make_people(100000));
+  compare<std::vector<Person>>("Large document", large, 20);
+  compare<std::vector<PersonName>>("Large document, skipping fields", large,
+                                   20);
+
+  const auto small = rfl::msgpack::write(make_people(1).front());
+  compare<Person>("Small document", small, 500000);
+  compare<PersonName>("Small document, skipping fields", small, 500000);
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+// Measures packing into a vector that grows as needed, which is what
+// msgpack::write does, against calling msgpack::packed_size first and
+// reserving the exact size, on large and small documents.
+//
+// Build with -DLEARN_REFLECT_CPP_BUILD_BENCHMARKS=ON and -O2 or higher.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Address {
+  std::string street;
+  std::string city;
+  int zip;
+};
+
+struct Person {
+  std::string first_name;
+  std::string last_name;
+  int age;
+  double salary;
+  bool active;
+  std::vector<std::string> tags;
+  Address address;
+  std::optional<std::string> nickname;
+};
+
+std::vector<Person> make_people(const size_t _n) {
+  std::vector<Person> people;
+  people.reserve(_n);
+  for (size_t i = 0; i < _n; ++i) {
+    people.push_back(
+        Person{.first_name = "Homer " + std::to_string(i),
+               .last_name = "Simpson \"The Man\"",
+               .age = static_cast<int>(i % 90),
+               .salary = 1234.5678 * static_cast<double>(i),
+               .active = i % 2 == 0,
+               .tags = {"nuclear", "safety", "inspector", "sector 7G"},
+               .address = Address{.street = "742 Evergreen Terrace",
+                                  .city = "Springfield",
+                                  .zip = 58008},
+               .nickname = i % 3 == 0 ? std::optional<std::string>("Homie")
+                                      : std::nullopt});
+  }
+  return people;
+}
+
+/// Calls _f _iterations times and prints the throughput. _f returns the
+/// number of bytes it wrote.
+template <class F>
+void run(const char* _label, const size_t _size, const size_t _iterations,
+         const F& _f) {
+  const auto begin = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < _iterations; ++i) {
+    if (_f() != _size) {
+      std::fprintf(stderr, "%s: Writing failed.\n", _label);
+      std::exit(1);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto seconds = std::chrono::duration<double>(end - begin).count();
+  const auto mb = static_cast<double>(_size * _iterations) / 1e6;
+  std::printf("%-24s %12.2f us/iter %10.1f MB/s\n", _label,
+              seconds * 1e6 / static_cast<double>(_iterations), mb / seconds);
+}
+
+template <class T>
+void compare(const char* _name, const T& _obj, const size_t _iterations) {
+  const auto size = rfl::msgpack::write(_obj).size();
+  std::printf("\n%s (%zu bytes, %zu iterations)\n", _name, size, _iterations);
+  run("growing vector", size, _iterations,
+      [&]() { return rfl::msgpack::write(_obj).size(); });
+  run("packed_size only", size, _iterations,
+      [&]() { return rfl::msgpack::packed_size(_obj); });
+  run("packed_size + reserve", size, _iterations, [&]() {
+    std::vector<char> bytes;
+    bytes.reserve(rfl::msgpack::packed_size(_obj));
+    rfl::msgpack::write_to(_obj, bytes);
+    return bytes.size();
+  });
+}
+
+}  // namespace
+
+int main() {
+  compare("Large document", make_people(100000), 20);
+  compare("Small document", make_people(1).front(), 500000);
+  return 0;
+}
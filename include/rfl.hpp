@@ -14,6 +14,7 @@
 #include "rfl/AnyOf.hpp"
 #include "rfl/Attribute.hpp"
 #include "rfl/Binary.hpp"
+#include "rfl/Borrowed.hpp"
 #include "rfl/Box.hpp"
 #include "rfl/Bytestring.hpp"
 #include "rfl/DefaultIfMissing.hpp"
@@ -25,12 +26,14 @@
 #include "rfl/Hex.hpp"
 #include "rfl/Literal.hpp"
 #include "rfl/NamedTuple.hpp"
+#include "rfl/NativeTimestamps.hpp"
 #include "rfl/NoExtraFields.hpp"
 #include "rfl/NoFieldNames.hpp"
 #include "rfl/NoOptionals.hpp"
 #include "rfl/Object.hpp"
 #include "rfl/Oct.hpp"
 #include "rfl/OneOf.hpp"
+#include "rfl/Parallel.hpp"
 #include "rfl/Pattern.hpp"
 #include "rfl/PatternValidator.hpp"
 #include "rfl/Processors.hpp"
@@ -0,0 +1,53 @@
+#ifndef RFL_BORROWED_HPP_
+#define RFL_BORROWED_HPP_
+
+#include <memory>
+#include <utility>
+
+namespace rfl {
+
+/// The result of read_borrowed(...): A parsed value, whose std::string_view
+/// and std::span<const std::byte> fields point directly into the parsed
+/// document, together with whatever owns that document. The views remain valid
+/// for as long as the Borrowed (or any copy of it) exists, so you must not let
+/// them escape it.
+template <class T>
+class Borrowed {
+ public:
+  Borrowed(T&& _value, std::shared_ptr<const void> _owner)
+      : owner_(std::move(_owner)), value_(std::move(_value)) {}
+
+  Borrowed(const Borrowed<T>& _other) = default;
+
+  Borrowed(Borrowed<T>&& _other) noexcept = default;
+
+  ~Borrowed() = default;
+
+  /// Returns the underlying object.
+  const T& get() const noexcept { return value_; }
+
+  /// Returns the underlying object.
+  const T& operator*() const noexcept { return value_; }
+
+  /// Returns the underlying object.
+  const T* operator->() const noexcept { return &value_; }
+
+  /// Returns whatever owns the memory the views point into.
+  const std::shared_ptr<const void>& owner() const noexcept { return owner_; }
+
+  Borrowed<T>& operator=(const Borrowed<T>& _other) = default;
+
+  Borrowed<T>& operator=(Borrowed<T>&& _other) noexcept = default;
+
+ private:
+  /// Owns the memory the views point into. Declared before value_, so that it
+  /// is destroyed after it.
+  std::shared_ptr<const void> owner_;
+
+  /// The underlying value.
+  T value_;
+};
+
+}  // namespace rfl
+
+#endif
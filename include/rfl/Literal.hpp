@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -12,6 +13,7 @@
 
 #include "Result.hpp"
 #include "Tuple.hpp"
+#include "internal/StringIndexTable.hpp"
 #include "internal/StringLiteral.hpp"
 #include "internal/no_duplicate_field_names.hpp"
 
@@ -81,10 +83,8 @@ class Literal {
   }
 
   /// Determines whether the literal contains the string.
-  static bool contains(const std::string& _str) {
-    bool found = false;
-    has_value(_str, &found);
-    return found;
+  static bool contains(const std::string_view _str) {
+    return find_index(_str) != -1;
   }
 
   /// Determines whether the literal contains the string at compile time.
@@ -140,6 +140,12 @@ class Literal {
   /// The name defined by the Literal.
   std::string name() const { return find_name(); }
 
+  /// Returns the value associated with the string or -1, if the literal does
+  /// not contain the string. Does not allocate.
+  static int find_index(const std::string_view _str) noexcept {
+    return field_indices_.find(_str);
+  }
+
   /// Returns all possible values of the literal as a std::vector<std::string>.
   static std::vector<std::string> names() {
     return allowed_strings_vec(std::make_integer_sequence<int, num_fields_>());
@@ -302,10 +308,8 @@ class Literal {
   /// Finds the correct value associated with
   /// the string at run time.
   static Result<int> find_value(const std::string& _str) {
-    bool found = false;
-    const auto idx = find_value_set_idx(
-        _str, &found, std::make_integer_sequence<int, num_fields_>());
-    if (!found) {
+    const auto idx = find_index(_str);
+    if (idx == -1) {
       return error(
           "Literal does not support string '" + _str +
           "'. The following strings are supported: " + allowed_strings() + ".");
@@ -313,24 +317,6 @@ class Literal {
     return idx;
   }
 
-  template <int... _is>
-  static int find_value_set_idx(const std::string& _str, bool* _found,
-                                std::integer_sequence<int, _is...>) {
-    int idx = 0;
-    (find_value_set_if_matches<_is>(_str, _found, &idx), ...);
-    return idx;
-  }
-
-  template <int _i>
-  static void find_value_set_if_matches(const std::string& _str, bool* _found,
-                                        int* _idx) {
-    using FieldType = tuple_element_t<_i, FieldsType>;
-    if (!*_found && FieldType::name_.string_view() == _str) {
-      *_idx = _i;
-      *_found = true;
-    }
-  }
-
   /// Finds the value of a string literal at compile time.
   template <internal::StringLiteral _name, int _i = 0>
   static constexpr int find_value_of() {
@@ -346,18 +332,16 @@ class Literal {
     }
   }
 
-  /// Whether the literal contains this string.
-  static void has_value(const std::string& _str, bool* _found) {
-    find_value_set_idx(_str, _found,
-                       std::make_integer_sequence<int, num_fields_>());
-  }
-
   static_assert(sizeof...(fields_) <= std::numeric_limits<ValueType>::max(),
                 "Too many fields.");
 
   static_assert(sizeof...(fields_) <= 1 || !has_duplicates(),
                 "Duplicate strings are not allowed in a Literal.");
 
+  /// Maps the strings to their values at compile time.
+  static constexpr auto field_indices_ =
+      internal::make_field_index_table<FieldsType>();
+
  private:
   /// The underlying value.
   ValueType value_;
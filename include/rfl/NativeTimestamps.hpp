@@ -0,0 +1,26 @@
+#ifndef RFL_NATIVETIMESTAMPS_HPP_
+#define RFL_NATIVETIMESTAMPS_HPP_
+
+namespace rfl {
+
+/// This is a "fake" processor - it doesn't do much in itself, but its
+/// inclusion instructs the parsers to encode rfl::Timestamp using the native
+/// time stamp type of the format rather than as a formatted string:
+///
+///   rfl::msgpack::write<rfl::NativeTimestamps>(obj);
+///
+/// The time stamps are interpreted as UTC. Formats that support this are
+/// msgpack (extension type -1), CBOR (tag 1), BSON (UTC datetime) and Avro
+/// (timestamp-millis). All other formats still use strings. Because the
+/// encoding differs, the processor must be passed to both read and write.
+struct NativeTimestamps {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+}  // namespace rfl
+
+#endif
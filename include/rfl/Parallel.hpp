@@ -0,0 +1,27 @@
+#ifndef RFL_PARALLEL_HPP_
+#define RFL_PARALLEL_HPP_
+
+namespace rfl {
+
+/// This is a "fake" processor - it doesn't do much in itself, but its
+/// inclusion instructs the parsers to decode the elements of large arrays into
+/// a std::vector on several threads:
+///
+///   rfl::json::read<std::vector<Record>, rfl::Parallel>(json_str);
+///
+/// This only applies to readers that support it (see SupportsParallelReading)
+/// and to elements that are default-constructible. Smaller arrays and arrays
+/// nested inside an array that is already being read in parallel are read
+/// sequentially. If several elements cannot be parsed, the error of the first
+/// one is returned, just like without this processor.
+struct Parallel {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+}  // namespace rfl
+
+#endif
@@ -4,11 +4,14 @@
 #include <type_traits>
 
 #include "internal/is_add_tags_to_variants_v.hpp"
+#include "internal/is_allow_borrowing_v.hpp"
 #include "internal/is_allow_raw_ptrs_v.hpp"
 #include "internal/is_default_if_missing_v.hpp"
+#include "internal/is_native_timestamps_v.hpp"
 #include "internal/is_no_extra_fields_v.hpp"
 #include "internal/is_no_field_names_v.hpp"
 #include "internal/is_no_optionals_v.hpp"
+#include "internal/is_parallel_v.hpp"
 #include "internal/is_underlying_enums_v.hpp"
 
 namespace rfl {
@@ -19,11 +22,14 @@ struct Processors;
 template <>
 struct Processors<> {
   static constexpr bool add_tags_to_variants_ = false;
+  static constexpr bool allow_borrowing_ = false;
   static constexpr bool allow_raw_ptrs_ = false;
   static constexpr bool all_required_ = false;
   static constexpr bool default_if_missing_ = false;
+  static constexpr bool native_timestamps_ = false;
   static constexpr bool no_extra_fields_ = false;
   static constexpr bool no_field_names_ = false;
+  static constexpr bool parallel_ = false;
   static constexpr bool underlying_enums_ = false;
 
   template <class T, class NamedTupleType>
@@ -38,6 +44,10 @@ struct Processors<Head, Tail...> {
       std::disjunction_v<internal::is_add_tags_to_variants<Head>,
                          internal::is_add_tags_to_variants<Tail>...>;
 
+  static constexpr bool allow_borrowing_ =
+      std::disjunction_v<internal::is_allow_borrowing<Head>,
+                         internal::is_allow_borrowing<Tail>...>;
+
   static constexpr bool allow_raw_ptrs_ =
       std::disjunction_v<internal::is_allow_raw_ptrs<Head>,
                          internal::is_allow_raw_ptrs<Tail>...>;
@@ -50,6 +60,10 @@ struct Processors<Head, Tail...> {
       std::disjunction_v<internal::is_default_if_missing<Head>,
                          internal::is_default_if_missing<Tail>...>;
 
+  static constexpr bool native_timestamps_ =
+      std::disjunction_v<internal::is_native_timestamps<Head>,
+                         internal::is_native_timestamps<Tail>...>;
+
   static constexpr bool no_extra_fields_ =
       std::disjunction_v<internal::is_no_extra_fields<Head>,
                          internal::is_no_extra_fields<Tail>...>;
@@ -58,6 +72,10 @@ struct Processors<Head, Tail...> {
       std::disjunction_v<internal::is_no_field_names<Head>,
                          internal::is_no_field_names<Tail>...>;
 
+  static constexpr bool parallel_ =
+      std::disjunction_v<internal::is_parallel<Head>,
+                         internal::is_parallel<Tail>...>;
+
   static constexpr bool underlying_enums_ =
       std::disjunction_v<internal::is_underlying_enums<Head>,
                          internal::is_underlying_enums<Tail>...>;
@@ -1,12 +1,14 @@
 #ifndef RFL_TIMESTAMP_HPP_
 #define RFL_TIMESTAMP_HPP_
 
+#include <chrono>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 
+#include "Literal.hpp"
 #include "Result.hpp"
 #include "internal/StringLiteral.hpp"
 
@@ -37,6 +39,22 @@ class Timestamp {
 
   Timestamp(const std::tm& _tm) : tm_(_tm) {}
 
+  /// The time stamp is expressed in UTC.
+  Timestamp(const std::chrono::sys_seconds _time_point) : tm_(std::tm{}) {
+    using namespace std::chrono;
+    const auto days = floor<std::chrono::days>(_time_point);
+    const auto ymd = year_month_day(days);
+    const auto time = hh_mm_ss<seconds>(_time_point - days);
+    tm_.tm_year = static_cast<int>(ymd.year()) - 1900;
+    tm_.tm_mon = static_cast<int>(static_cast<unsigned>(ymd.month())) - 1;
+    tm_.tm_mday = static_cast<int>(static_cast<unsigned>(ymd.day()));
+    tm_.tm_hour = static_cast<int>(time.hours().count());
+    tm_.tm_min = static_cast<int>(time.minutes().count());
+    tm_.tm_sec = static_cast<int>(time.seconds().count());
+    tm_.tm_wday = static_cast<int>(weekday(days).c_encoding());
+    tm_.tm_yday = (days - sys_days(ymd.year() / January / 1)).count();
+  }
+
   ~Timestamp() = default;
 
   /// Returns a result containing the timestamp when successful or an Error
@@ -65,6 +83,17 @@ class Timestamp {
   /// Expresses the underlying timestamp as a string.
   std::string str() const { return reflection(); }
 
+  /// Expresses the underlying timestamp as a point in time, interpreting it
+  /// as UTC. Fields that are out of range are normalized, like timegm(...)
+  /// would.
+  std::chrono::sys_seconds time_point() const {
+    using namespace std::chrono;
+    const auto month = year(tm_.tm_year + 1900) / January + months(tm_.tm_mon);
+    const auto days = sys_days(month / 1) + std::chrono::days(tm_.tm_mday - 1);
+    return days + hours(tm_.tm_hour) + minutes(tm_.tm_min) +
+           seconds(tm_.tm_sec);
+  }
+
   /// Trivial accessor to the underlying time stamp.
   std::tm& tm() { return tm_; }
 
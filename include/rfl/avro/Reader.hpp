@@ -3,6 +3,7 @@
 
 #include <avro.h>
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <string>
@@ -45,6 +46,9 @@ struct Reader {
   using InputUnionType = AVROInputUnion;
   using InputVarType = AVROInputVar;
 
+  /// Time stamps are read from timestamp-millis.
+  static constexpr bool supports_timestamps = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_avro_obj(var); });
@@ -135,6 +139,16 @@ struct Reader {
       return std::remove_cvref_t<T>::from_value(
           static_cast<typename std::remove_cvref_t<T>::ValueType>(value));
 
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      int64_t millis = 0;
+      if (type != AVRO_INT64 || avro_value_get_long(_var.val_, &millis)) {
+        return error("Could not cast to timestamp.");
+      }
+      return std::chrono::floor<std::chrono::seconds>(
+          std::chrono::sys_time<std::chrono::milliseconds>(
+              std::chrono::milliseconds(millis)));
+
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -174,6 +188,12 @@ struct Reader {
     return InputUnionType{_var.val_};
   }
 
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    size_t size = 0;
+    avro_value_get_size(_arr.val_, &size);
+    return size;
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
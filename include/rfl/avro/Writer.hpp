@@ -4,6 +4,7 @@
 #include <avro.h>
 
 #include <bit>
+#include <chrono>
 #include <cstdint>
 #include <exception>
 #include <map>
@@ -52,6 +53,9 @@ class Writer {
   using OutputUnionType = AVROOutputUnion;
   using OutputVarType = AVROOutputVar;
 
+  /// Time stamps are written as timestamp-millis.
+  static constexpr bool supports_timestamps = true;
+
   Writer(avro_value_t* _root);
 
   ~Writer();
@@ -185,6 +189,11 @@ class Writer {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
       avro_value_set_string_len(_val, _var.c_str(), _var.size() + 1);
 
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      // Avro requires a null-terminated string.
+      set_value(std::string(_var), _val);
+
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
       auto var = _var;
@@ -202,6 +211,13 @@ class Writer {
     } else if constexpr (internal::is_literal_v<T>) {
       avro_value_set_enum(_val, static_cast<int>(_var.value()));
 
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      avro_value_set_long(
+          _val, std::chrono::duration_cast<std::chrono::milliseconds>(
+                    _var.time_since_epoch())
+                    .count());
+
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -47,6 +47,11 @@ struct Type {
     Literal<"string"> type;
   };
 
+  struct TimestampMillis {
+    Literal<"long"> type;
+    Literal<"timestamp-millis"> logicalType;
+  };
+
   struct RecordField {
     std::string name;
     rfl::Ref<Type> type;
@@ -83,7 +88,8 @@ struct Type {
 
   using ReflectionType =
       rfl::Variant<Null, Boolean, Int, Long, Float, Double, Bytes, String,
-                   Record, Enum, Array, Map, Reference, std::vector<Type>>;
+                   TimestampMillis, Record, Enum, Array, Map, Reference,
+                   std::vector<Type>>;
 
   const auto& reflection() const { return value; }
 
@@ -4,6 +4,7 @@
 #include <bson/bson.h>
 
 #include <array>
+#include <chrono>
 #include <concepts>
 #include <cstddef>
 #include <exception>
@@ -45,6 +46,9 @@ struct Reader {
   using InputObjectType = BSONInputObject;
   using InputVarType = BSONInputVar;
 
+  /// Time stamps are read from UTC datetime.
+  static constexpr bool supports_timestamps = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_bson_obj(var); });
@@ -161,6 +165,14 @@ struct Reader {
         return error("Could not cast to OID.");
       }
       return value.v_oid;
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      if (btype != BSON_TYPE_DATE_TIME) {
+        return error("Could not cast to timestamp.");
+      }
+      return std::chrono::floor<std::chrono::seconds>(
+          std::chrono::sys_time<std::chrono::milliseconds>(
+              std::chrono::milliseconds(value.v_datetime)));
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
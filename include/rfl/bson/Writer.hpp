@@ -3,6 +3,7 @@
 
 #include <bson/bson.h>
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <map>
@@ -63,6 +64,9 @@ class Writer {
   using OutputObjectType = BSONOutputObject;
   using OutputVarType = BSONOutputVar;
 
+  /// Time stamps are written as UTC datetime.
+  static constexpr bool supports_timestamps = true;
+
   Writer(bson_t* _doc);
 
   ~Writer();
@@ -97,8 +101,9 @@ class Writer {
   template <class T>
   OutputVarType add_value_to_array(const T& _var,
                                    OutputArrayType* _parent) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      bson_array_builder_append_utf8(_parent->val_, _var.c_str(),
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      bson_array_builder_append_utf8(_parent->val_, _var.data(),
                                      static_cast<int>(_var.size()));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
@@ -116,6 +121,9 @@ class Writer {
                                       static_cast<std::int64_t>(_var));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bson_oid_t>()) {
       bson_array_builder_append_oid(_parent->val_, &_var);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      bson_array_builder_append_date_time(_parent->val_, to_millis(_var));
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -126,9 +134,10 @@ class Writer {
   OutputVarType add_value_to_object(const std::string_view& _name,
                                     const T& _var,
                                     OutputObjectType* _parent) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
       bson_append_utf8(_parent->val_, _name.data(),
-                       static_cast<int>(_name.size()), _var.c_str(),
+                       static_cast<int>(_name.size()), _var.data(),
                        static_cast<int>(_var.size()));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
@@ -150,6 +159,10 @@ class Writer {
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bson_oid_t>()) {
       bson_append_oid(_parent->val_, _name.data(),
                       static_cast<int>(_name.size()), &_var);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      bson_append_date_time(_parent->val_, _name.data(),
+                            static_cast<int>(_name.size()), to_millis(_var));
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -165,6 +178,14 @@ class Writer {
 
   void end_object(OutputObjectType* _obj) const noexcept;
 
+ private:
+  /// BSON datetimes are milliseconds since the epoch.
+  static std::int64_t to_millis(const std::chrono::sys_seconds _t) noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               _t.time_since_epoch())
+        .count();
+  }
+
  private:
   /// Pointer to the main document. In BSON, documents are what are usually
   /// called objects.
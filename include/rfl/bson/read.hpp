@@ -9,6 +9,7 @@
 #include "../Processors.hpp"
 #include "../internal/ptr_cast.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -59,6 +60,46 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses a BSON var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const InputVarType& _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for BSON, XML, "
+                "TOML, or YAML.");
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses BSON into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const uint8_t* _bytes,
+                          const size_t _size) {
+  bson_value_t val;
+  val.value.v_doc.data_len = static_cast<uint32_t>(_size);
+  val.value.v_doc.data = const_cast<uint8_t*>(_bytes);
+  val.value_type = BSON_TYPE_DOCUMENT;
+  return read_into<Ps...>(_target, Reader::InputVarType{&val});
+}
+
+/// Parses BSON into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(
+      _target, internal::ptr_cast<const uint8_t*>(_bytes.data()),
+      _bytes.size());
+}
+
 }  // namespace bson
 }  // namespace rfl
 
@@ -7,6 +7,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../Processors.hpp"
 #include "../internal/ptr_cast.hpp"
@@ -51,6 +52,15 @@ std::vector<char> write(const auto& _obj) noexcept {
   return result;
 }
 
+/// Appends BSON bytes to _out.
+template <class... Ps>
+void write_to(const auto& _obj, std::vector<char>& _out) noexcept {
+  auto [buf, len] = to_buffer<Ps...>(_obj);
+  const auto data = internal::ptr_cast<const char*>(buf);
+  _out.insert(_out.end(), data, data + len);
+  bson_free(buf);
+}
+
 /// Writes a BSON into an ostream.
 template <class... Ps>
 std::ostream& write(const auto& _obj, std::ostream& _stream) noexcept {
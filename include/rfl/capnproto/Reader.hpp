@@ -138,6 +138,10 @@ class Reader {
     return InputUnionType{_var.val_.as<capnp::DynamicStruct>()};
   }
 
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.val_.size();
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
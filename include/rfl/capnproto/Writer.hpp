@@ -164,8 +164,10 @@ class Writer {
   template <class T>
   OutputVarType add_value_to_array(const T& _var,
                                    OutputArrayType* _parent) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      _parent->val_.set(_parent->ix_++, _var.c_str());
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      _parent->val_.set(_parent->ix_++,
+                        capnp::Text::Reader(_var.data(), _var.size()));
 
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
@@ -203,8 +205,10 @@ class Writer {
   OutputVarType add_value_to_object(const std::string_view& _name,
                                     const T& _var,
                                     OutputObjectType* _parent) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      _parent->val_.set(_name.data(), _var.c_str());
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      _parent->val_.set(_name.data(),
+                        capnp::Text::Reader(_var.data(), _var.size()));
 
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
@@ -233,8 +237,9 @@ class Writer {
                                    OutputUnionType* _parent) const noexcept {
     const auto field = _parent->val_.getSchema().getFields()[_index];
 
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      _parent->val_.set(field, _var.c_str());
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      _parent->val_.set(field, capnp::Text::Reader(_var.data(), _var.size()));
 
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
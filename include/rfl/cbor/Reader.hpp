@@ -1,6 +1,8 @@
 #ifndef RFL_CBOR_READER_HPP_
 #define RFL_CBOR_READER_HPP_
 
+#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <exception>
 #include <jsoncons/json.hpp>
@@ -34,10 +36,16 @@ class Reader {
   using InputObjectType = CBORInputObject;
   using InputVarType = CBORInputVar;
 
+  /// Time stamps are read from epoch-based date/time (tag 1).
+  static constexpr bool supports_timestamps = true;
+
   Reader() {}
 
   ~Reader() = default;
 
+  /// jsoncons::json keeps the members of an object sorted by their keys.
+  static constexpr bool reorders_keys = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_cbor_obj(var); });
@@ -50,20 +58,34 @@ class Reader {
     return InputVarType{&_arr.val_->at(_idx)};
   }
 
+  /// jsoncons::json keeps the members of an object sorted by their keys, so
+  /// find(...) is a binary search.
   rfl::Result<InputVarType> get_field_from_object(
       const std::string& _name, const InputObjectType& _obj) const noexcept {
-    for (auto& kv : _obj.val_->object_range()) {
-      if (kv.key() == _name) {
-        return InputVarType{&kv.value()};
-      };
+    const auto it = _obj.val_->find(_name);
+    if (it == _obj.val_->object_range().end()) {
+      return error("Field name '" + _name + "' not found.");
     }
-    return error("Field name '" + _name + "' not found.");
+    return InputVarType{&it->value()};
+  }
+
+  bool has_field(const std::string_view _name,
+                 const InputObjectType& _obj) const noexcept {
+    return _obj.val_->find(_name) != _obj.val_->object_range().end();
   }
 
   bool is_empty(const InputVarType& _var) const noexcept {
     return _var.val_->is_null();
   }
 
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    if (!_var.val_->is_string()) {
+      return error("Could not cast to string.");
+    }
+    return _var.val_->as_string_view();
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
@@ -102,6 +124,21 @@ class Reader {
       }
       return error("Could not cast to integer.");
 
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      if (_var.val_->tag() != jsoncons::semantic_tag::epoch_second) {
+        return error("Could not cast to timestamp.");
+      }
+      if (_var.val_->is_int64() || _var.val_->is_uint64()) {
+        return std::chrono::sys_seconds(
+            std::chrono::seconds(_var.val_->as<int64_t>()));
+      }
+      if (_var.val_->is_double()) {
+        return std::chrono::sys_seconds(std::chrono::seconds(
+            static_cast<int64_t>(std::floor(_var.val_->as<double>()))));
+      }
+      return error("Could not cast to timestamp.");
+
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -123,6 +160,14 @@ class Reader {
     return InputObjectType{_var.val_};
   }
 
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.val_->size();
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.val_->size();
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
@@ -2,6 +2,7 @@
 #define RFL_CBOR_WRITER_HPP_
 
 #include <bit>
+#include <chrono>
 #include <exception>
 #include <jsoncons_ext/cbor/cbor_encoder.hpp>
 #include <map>
@@ -35,6 +36,9 @@ class Writer {
   using OutputObjectType = CBOROutputObject;
   using OutputVarType = CBOROutputVar;
 
+  /// Time stamps are written as epoch-based date/time (tag 1).
+  static constexpr bool supports_timestamps = true;
+
   Writer(Encoder* _encoder);
 
   ~Writer();
@@ -94,7 +98,8 @@ class Writer {
 
   template <class T>
   OutputVarType new_value(const T& _var) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
       encoder_->string_value(_var);
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
@@ -105,6 +110,11 @@ class Writer {
       encoder_->double_value(static_cast<double>(_var));
     } else if constexpr (std::is_integral<std::remove_cvref_t<T>>()) {
       encoder_->int64_value(static_cast<std::int64_t>(_var));
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      encoder_->int64_value(
+          static_cast<std::int64_t>(_var.time_since_epoch().count()),
+          jsoncons::semantic_tag::epoch_second);
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -9,6 +9,7 @@
 
 #include "../Processors.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -33,6 +34,30 @@ Result<internal::wrap_in_rfl_array_t<T>> read(std::istream& _stream) {
   return Parser<T, Processors<Ps...>>::read(r, InputVarType{&val});
 }
 
+/// Parses a CBOR var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const InputVarType& _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses CBOR into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::vector<char>& _bytes) {
+  auto val = jsoncons::cbor::decode_cbor<jsoncons::json>(_bytes);
+  return read_into<Ps...>(_target, InputVarType{&val});
+}
+
 }  // namespace rfl::cbor
 
 #endif
@@ -7,6 +7,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../internal/ptr_cast.hpp"
 #include "../parsing/Parent.hpp"
@@ -29,6 +30,20 @@ std::vector<char> write(const auto& _obj) noexcept {
       internal::ptr_cast<char*>(buffer.data() + buffer.size()));
 }
 
+/// Appends CBOR bytes to _out.
+template <class... Ps>
+void write_to(const auto& _obj, std::vector<char>& _out) noexcept {
+  using T = std::remove_cvref_t<decltype(_obj)>;
+  using ParentType = parsing::Parent<Writer>;
+  std::vector<uint8_t> buffer;
+  jsoncons::cbor::cbor_bytes_encoder encoder(buffer);
+  const auto writer = Writer(&encoder);
+  Parser<T, Processors<Ps...>>::write(writer, _obj,
+                                      typename ParentType::Root{});
+  const auto data = internal::ptr_cast<const char*>(buffer.data());
+  _out.insert(_out.end(), data, data + buffer.size());
+}
+
 /// Writes a CBOR into an ostream.
 template <class... Ps>
 std::ostream& write(const auto& _obj, std::ostream& _stream) noexcept {
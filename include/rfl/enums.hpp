@@ -2,6 +2,7 @@
 #define RFL_ENUMS_HPP_
 
 #include <string>
+#include <string_view>
 
 #include "Result.hpp"
 #include "internal/enums/StringConverter.hpp"
@@ -19,7 +20,7 @@ std::string enum_to_string(EnumType _enum) {
 
 // Converts a string to a value of the given enum type.
 template <internal::enums::is_scoped_enum EnumType>
-rfl::Result<EnumType> string_to_enum(const std::string& _str) {
+rfl::Result<EnumType> string_to_enum(const std::string_view _str) {
   return rfl::internal::enums::StringConverter<EnumType>::string_to_enum(_str);
 }
 
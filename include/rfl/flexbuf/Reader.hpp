@@ -6,6 +6,8 @@
 #include <cstddef>
 #include <exception>
 #include <map>
+#include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -26,6 +28,9 @@ struct Reader {
   using InputObjectType = flexbuffers::Map;
   using InputVarType = flexbuffers::Reference;
 
+  /// Flexbuffers store the keys of a map in sorted order.
+  static constexpr bool reorders_keys = true;
+
   template <class T, class = void>
   struct has_from_flexbuf : std::false_type {};
 
@@ -54,19 +59,42 @@ struct Reader {
 
   rfl::Result<InputVarType> get_field_from_object(
       const std::string& _name, const InputObjectType& _obj) const noexcept {
-    const auto keys = _obj.Keys();
-    for (size_t i = 0; i < keys.size(); ++i) {
-      if (_name == keys[i].AsString().c_str()) {
-        return _obj.Values()[i];
-      }
+    const auto ix = find_key(_name, _obj);
+    if (!ix) {
+      return error("Map does not contain any element called '" + _name +
+                   "'.");
     }
-    return error("Map does not contain any element called '" + _name + "'.");
+    return _obj.Values()[*ix];
+  }
+
+  bool has_field(const std::string_view _name,
+                 const InputObjectType& _obj) const noexcept {
+    return find_key(_name, _obj).has_value();
   }
 
   bool is_empty(const InputVarType& _var) const noexcept {
     return _var.IsNull();
   }
 
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    if (!_var.IsString()) {
+      return error("Could not cast to a string.");
+    }
+    const auto str = _var.AsString();
+    return std::string_view(str.c_str(), str.length());
+  }
+
+  rfl::Result<std::span<const std::byte>> to_bytes_view(
+      const InputVarType& _var) const noexcept {
+    if (!_var.IsBlob()) {
+      return error("Could not cast to a bytestring.");
+    }
+    const auto blob = _var.AsBlob();
+    return std::span<const std::byte>(
+        internal::ptr_cast<const std::byte*>(blob.data()), blob.size());
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
@@ -107,6 +135,14 @@ struct Reader {
     }
   }
 
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.size();
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.size();
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
@@ -160,6 +196,29 @@ struct Reader {
       return error(e.what());
     }
   }
+
+ private:
+  /// Flexbuffers sorts the keys of a map when it is built, so we can use
+  /// binary search. The keys are compared like strcmp(...) does, which is the
+  /// order they are sorted in.
+  std::optional<size_t> find_key(const std::string_view _name,
+                                 const InputObjectType& _obj) const noexcept {
+    const auto keys = _obj.Keys();
+    size_t begin = 0;
+    size_t end = keys.size();
+    while (begin < end) {
+      const size_t mid = begin + (end - begin) / 2;
+      const int cmp = std::string_view(keys[mid].AsKey()).compare(_name);
+      if (cmp == 0) {
+        return mid;
+      } else if (cmp < 0) {
+        begin = mid + 1;
+      } else {
+        end = mid;
+      }
+    }
+    return std::nullopt;
+  }
 };
 
 }  // namespace flexbuf
@@ -93,8 +93,10 @@ struct Writer {
   template <class T>
   OutputVarType insert_value(const std::string_view& _name,
                              const T& _var) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      fbb_->String(_name.data(), _var);
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      fbb_->Key(_name.data());
+      fbb_->String(_var.data(), _var.size());
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
       fbb_->Blob(_name.data(), _var.c_str(), _var.size());
@@ -112,8 +114,9 @@ struct Writer {
 
   template <class T>
   OutputVarType insert_value(const T& _var) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      fbb_->String(_var);
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      fbb_->String(_var.data(), _var.size());
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
       fbb_->Blob(_var.c_str(), _var.size());
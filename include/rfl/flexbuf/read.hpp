@@ -4,11 +4,16 @@
 #include <flatbuffers/flexbuffers.h>
 
 #include <istream>
+#include <memory>
 #include <vector>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
 #include "../Result.hpp"
+#include "../internal/AllowBorrowing.hpp"
 #include "../internal/ptr_cast.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 
 namespace rfl {
@@ -45,6 +50,57 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses a flexbuf var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const InputVarType& _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses flexbuf into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const char* _bytes,
+                          const size_t _size) {
+  const InputVarType root =
+      flexbuffers::GetRoot(internal::ptr_cast<const uint8_t*>(_bytes), _size);
+  return read_into<Ps...>(_target, root);
+}
+
+/// Parses flexbuf into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(_target, _bytes.data(), _bytes.size());
+}
+
+/// Parses an object from flexbuf in borrowing mode: Any std::string_view and
+/// std::span<const std::byte> fields point directly into _bytes instead of
+/// being copied. The bytes are kept alive by the returned rfl::Borrowed.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    std::vector<char> _bytes) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  const auto bytes =
+      std::make_shared<const std::vector<char>>(std::move(_bytes));
+  const InputVarType root = flexbuffers::GetRoot(
+      internal::ptr_cast<const uint8_t*>(bytes->data()), bytes->size());
+  const auto to_borrowed = [&](U&& _value) {
+    return Borrowed<U>(std::move(_value), bytes);
+  };
+  return read<T, internal::AllowBorrowing, Ps...>(root).transform(
+      to_borrowed);
+}
+
 }  // namespace flexbuf
 }  // namespace rfl
 
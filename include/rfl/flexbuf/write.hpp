@@ -36,6 +36,20 @@ std::vector<char> write(const auto& _obj) {
   return std::vector<char>(data, data + buffer.size());
 }
 
+/// Appends an object in flexbuf format to _out.
+template <class... Ps>
+void write_to(const auto& _obj, std::vector<char>& _out) {
+  using T = std::remove_cvref_t<decltype(_obj)>;
+  using ParentType = parsing::Parent<Writer>;
+  const auto fbb = Ref<flexbuffers::Builder>::make();
+  auto w = Writer(fbb);
+  Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
+  fbb->Finish();
+  const auto& buffer = fbb->GetBuffer();
+  const auto data = internal::ptr_cast<const char*>(buffer.data());
+  _out.insert(_out.end(), data, data + buffer.size());
+}
+
 /// Writes an object to an ostream.
 template <class... Ps>
 std::ostream& write(const auto& _obj, std::ostream& _stream) {
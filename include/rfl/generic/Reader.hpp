@@ -65,6 +65,14 @@ struct Reader {
     }
   }
 
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.size();
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.size();
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
@@ -96,6 +96,9 @@ struct Writer {
   OutputVarType to_generic(const T& _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
       return OutputVarType(_var);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      return OutputVarType(std::string(_var));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       return OutputVarType(_var);
     } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
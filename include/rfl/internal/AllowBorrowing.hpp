@@ -0,0 +1,21 @@
+#ifndef RFL_INTERNAL_ALLOWBORROWING_HPP_
+#define RFL_INTERNAL_ALLOWBORROWING_HPP_
+
+namespace rfl::internal {
+
+/// This is a "fake" processor - it doesn't do much in itself, but its
+/// inclusion instructs the parsers to read std::string_view and
+/// std::span<const std::byte> as views into the input. It is added by
+/// read_borrowed(...), which makes sure that the input outlives the result,
+/// and is therefore not part of the public API.
+struct AllowBorrowing {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+}  // namespace rfl::internal
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef RFL_INTERNAL_FIELDINDEXLOOKUP_HPP_
+#define RFL_INTERNAL_FIELDINDEXLOOKUP_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+#include "../Tuple.hpp"
+#include "../parsing/FieldOrderStats.hpp"
+#include "StringIndexTable.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// Maps the names of the keys of an object to the index of the matching field
+/// in Fields, one key after the other. Keys usually arrive in declaration
+/// order (for instance, whenever the document was written by reflect-cpp), so
+/// the field following the last match is checked before falling back to the
+/// hash table.
+///
+/// Readers that visit the keys in sorted order pass _predict_order = false,
+/// because the prediction would nearly always miss and only cost an
+/// additional string comparison per key.
+template <class Fields, bool _predict_order>
+class FieldIndexLookup {
+  static constexpr int size_ = static_cast<int>(rfl::tuple_size_v<Fields>);
+
+ public:
+  /// Returns the index of the field named _name or -1, if there is no such
+  /// field.
+  int find(const std::string_view _name) noexcept {
+    if constexpr (_predict_order) {
+      if (next_index_ < size_ && field_indices_.str(next_index_) == _name) {
+        parsing::record_field_order_prediction(true);
+        return next_index_++;
+      }
+      parsing::record_field_order_prediction(false);
+      const int ix = field_indices_.find(_name);
+      if (ix != -1) {
+        next_index_ = ix + 1;
+      }
+      return ix;
+    } else {
+      return field_indices_.find(_name);
+    }
+  }
+
+ private:
+  /// The index of the field we expect to be read next.
+  int next_index_ = 0;
+
+  /// Maps the field names to their index at compile time.
+  static constexpr auto field_indices_ = make_field_index_table<Fields>();
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
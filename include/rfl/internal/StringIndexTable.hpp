@@ -0,0 +1,107 @@
+#ifndef RFL_INTERNAL_STRINGINDEXTABLE_HPP_
+#define RFL_INTERNAL_STRINGINDEXTABLE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "../Tuple.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// A hash table mapping a fixed set of strings to their position within that
+/// set. The table is built entirely at compile time, so a lookup at run time
+/// consists of hashing the key once and comparing it to (usually) a single
+/// candidate. Uses open addressing with linear probing and a load factor of at
+/// most 0.5.
+template <size_t N>
+class StringIndexTable {
+  static constexpr size_t calc_num_slots() {
+    size_t n = 2;
+    while (n < 2 * N) {
+      n *= 2;
+    }
+    return n;
+  }
+
+  static constexpr size_t num_slots_ = calc_num_slots();
+
+  struct Slot {
+    std::string_view str_;
+    int index_ = -1;
+  };
+
+ public:
+  constexpr StringIndexTable(const std::array<std::string_view, N>& _strings)
+      : slots_{}, strings_(_strings) {
+    // GCC 12 does not reliably apply the default member initializers of Slot
+    // through slots_{} when the table is built at run time.
+    for (auto& slot : slots_) {
+      slot = Slot{};
+    }
+    for (size_t i = 0; i < N; ++i) {
+      auto ix = hash(_strings[i]) & (num_slots_ - 1);
+      while (slots_[ix].index_ != -1) {
+        ix = (ix + 1) & (num_slots_ - 1);
+      }
+      slots_[ix] = Slot{_strings[i], static_cast<int>(i)};
+    }
+  }
+
+  /// Returns the position of _str or -1, if _str is not part of the table.
+  constexpr int find(const std::string_view _str) const noexcept {
+    auto ix = hash(_str) & (num_slots_ - 1);
+    while (slots_[ix].index_ != -1) {
+      if (slots_[ix].str_ == _str) {
+        return slots_[ix].index_;
+      }
+      ix = (ix + 1) & (num_slots_ - 1);
+    }
+    return -1;
+  }
+
+  /// Returns the string at position _i.
+  constexpr std::string_view str(const size_t _i) const noexcept {
+    return strings_[_i];
+  }
+
+  /// FNV-1a, seeded with the length of the string.
+  static constexpr std::uint64_t hash(const std::string_view _str) noexcept {
+    std::uint64_t h = 14695981039346656037ull ^ _str.size();
+    for (const char c : _str) {
+      h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    return h ^ (h >> 32);
+  }
+
+ private:
+  /// The hash table itself.
+  std::array<Slot, num_slots_> slots_;
+
+  /// The strings in their original order.
+  std::array<std::string_view, N> strings_;
+};
+
+template <class Fields, int... _is>
+constexpr auto make_field_index_table(std::integer_sequence<int, _is...>) {
+  return StringIndexTable<sizeof...(_is)>(std::array<std::string_view,
+                                                     sizeof...(_is)>{
+      tuple_element_t<_is, Fields>::name_.string_view()...});
+}
+
+/// Builds a StringIndexTable mapping the names in Fields (anything
+/// exposing a static name_, such as rfl::Field or rfl::LiteralHelper) to their
+/// index.
+template <class Fields>
+constexpr auto make_field_index_table() {
+  return make_field_index_table<Fields>(
+      std::make_integer_sequence<int, rfl::tuple_size_v<Fields>>());
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
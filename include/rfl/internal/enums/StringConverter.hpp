@@ -3,13 +3,18 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
+#include <utility>
 
 #include "../../Result.hpp"
-#include "../../internal/strings/strings.hpp"
 #include "../../type_name_t.hpp"
+#include "Names.hpp"
 #include "get_enum_names.hpp"
 #include "is_flag_enum.hpp"
 
@@ -24,6 +29,11 @@ class StringConverter {
 
   using NamesLiteral = typename decltype(names_)::Literal;
 
+ private:
+  using T = std::underlying_type_t<EnumType>;
+
+  using Pair = std::pair<T, std::string_view>;
+
  public:
   /// Transform an enum to a matching string.
   static std::string enum_to_string(const EnumType _enum) {
@@ -35,7 +45,7 @@ class StringConverter {
   }
 
   /// Transforms a string to the matching enum.
-  static Result<EnumType> string_to_enum(const std::string& _str) {
+  static Result<EnumType> string_to_enum(const std::string_view _str) {
     if constexpr (is_flag_enum_) {
       return string_to_flag_enum(_str);
     } else {
@@ -44,76 +54,156 @@ class StringConverter {
   }
 
  private:
+  /// The enumerators sorted by their value. If several enumerators share the
+  /// same value, the first one is kept.
+  static constexpr auto make_sorted() {
+    std::array<Pair, names_.size> sorted{};
+    if constexpr (names_.size != 0) {
+      const auto arr = names_to_enumerator_array(names_);
+      for (size_t i = 0; i < arr.size(); ++i) {
+        sorted[i] = Pair(static_cast<T>(arr[i].second), arr[i].first);
+      }
+      // Insertion sort, because std::stable_sort is not constexpr.
+      for (size_t i = 1; i < sorted.size(); ++i) {
+        for (size_t j = i; j > 0 && sorted[j].first < sorted[j - 1].first;
+             --j) {
+          std::swap(sorted[j], sorted[j - 1]);
+        }
+      }
+    }
+    return sorted;
+  }
+
+  static constexpr auto sorted_ = make_sorted();
+
+  /// The difference between the largest and the smallest value.
+  static constexpr std::uint64_t range() {
+    if constexpr (names_.size == 0) {
+      return 0;
+    } else {
+      return static_cast<std::uint64_t>(sorted_.back().first) -
+             static_cast<std::uint64_t>(sorted_.front().first);
+    }
+  }
+
+  /// If the values are reasonably close to each other, we can look up the
+  /// names directly, otherwise we use a binary search on sorted_.
+  static constexpr bool is_dense_ =
+      names_.size != 0 && range() < 4 * names_.size + 16;
+
+  static constexpr auto make_dense() {
+    if constexpr (is_dense_) {
+      std::array<std::string_view, range() + 1> dense{};
+      for (const auto& [val, name] : sorted_) {
+        const auto ix = static_cast<std::uint64_t>(val) -
+                        static_cast<std::uint64_t>(sorted_.front().first);
+        if (dense[ix].empty()) {
+          dense[ix] = name;
+        }
+      }
+      return dense;
+    } else {
+      return std::array<std::string_view, 0>{};
+    }
+  }
+
+  static constexpr auto dense_ = make_dense();
+
+  /// Returns the name of _enum, if _enum can be exactly matched to one of the
+  /// names.
+  static std::optional<std::string_view> find_name(const EnumType _enum) {
+    const auto val = static_cast<T>(_enum);
+    if constexpr (is_dense_) {
+      const auto ix = static_cast<std::uint64_t>(val) -
+                      static_cast<std::uint64_t>(sorted_.front().first);
+      if (ix < dense_.size() && !dense_[ix].empty()) {
+        return dense_[ix];
+      }
+    } else {
+      const auto it = std::lower_bound(
+          sorted_.begin(), sorted_.end(), val,
+          [](const Pair& _p, const T _v) { return _p.first < _v; });
+      if (it != sorted_.end() && it->first == val) {
+        return it->second;
+      }
+    }
+    return std::nullopt;
+  }
+
   /// Iterates through the enum bit by bit and matches it against the flags.
   static std::string flag_enum_to_string(const EnumType _e) {
-    using T = std::underlying_type_t<EnumType>;
     auto val = static_cast<T>(_e);
     int i = 0;
-    std::vector<std::string> flags;
+    std::string str;
     while (val != 0) {
       const auto bit = val & static_cast<T>(1);
       if (bit == 1) {
-        auto str = enum_to_single_string(
-            static_cast<EnumType>(static_cast<T>(1) << i));
-        flags.emplace_back(std::move(str));
+        if (!str.empty()) {
+          str += '|';
+        }
+        append_single_string(static_cast<EnumType>(static_cast<T>(1) << i),
+                             &str);
       }
       ++i;
       val >>= 1;
     }
-    return strings::join("|", flags);
+    return str;
   }
 
   /// This assumes that _enum can be exactly matched to one of the names and
   /// does not have to be combined using |.
   static std::string enum_to_single_string(const EnumType _enum) {
-    const auto to_str = [](const auto _l) { return _l.str(); };
-
-    for (size_t i = 0; i < names_.size; ++i) {
-      if (names_.enums_[i] == _enum) {
-        return NamesLiteral::from_value(
-                   static_cast<typename NamesLiteral::ValueType>(i))
-            .transform(to_str)
-            .value();
-      }
-    }
-
-    return std::to_string(static_cast<std::underlying_type_t<EnumType>>(_enum));
+    std::string str;
+    append_single_string(_enum, &str);
+    return str;
   }
 
-  /// Finds the enum matching the literal.
-  static EnumType literal_to_enum(const NamesLiteral _lit) noexcept {
-    return names_.enums_[_lit.value()];
+  static void append_single_string(const EnumType _enum, std::string* _str) {
+    const auto name = find_name(_enum);
+    if (name) {
+      _str->append(*name);
+    } else {
+      *_str += std::to_string(static_cast<T>(_enum));
+    }
   }
 
   /// This assumes that _enum can be exactly matched to one of the names and
   /// does not have to be combined using |.
-  static Result<EnumType> single_string_to_enum(const std::string& _str) {
-    const auto r = NamesLiteral::from_string(_str).transform(literal_to_enum);
-    if (r) {
-      return r;
-    } else {
-      try {
-        return static_cast<EnumType>(std::stoi(_str));
-      } catch (std::exception& exp) {
-        return error(exp.what());
+  static Result<EnumType> single_string_to_enum(const std::string_view _str) {
+    if constexpr (names_.size != 0) {
+      const auto ix = NamesLiteral::find_index(_str);
+      if (ix != -1) {
+        return names_.enums_[ix];
       }
     }
+    T val{};
+    const auto [ptr, ec] =
+        std::from_chars(_str.data(), _str.data() + _str.size(), val);
+    if (ec != std::errc() || ptr != _str.data() + _str.size()) {
+      return error("Could not convert '" + std::string(_str) +
+                   "' to an enum: It is neither one of the enumerators nor a "
+                   "valid integer.");
+    }
+    return static_cast<EnumType>(val);
   }
 
   /// Only relevant if this is a flag enum - combines the different matches
   /// using |.
   static Result<EnumType> string_to_flag_enum(
-      const std::string& _str) noexcept {
-    using T = std::underlying_type_t<EnumType>;
-    const auto split = strings::split(_str, "|");
+      const std::string_view _str) noexcept {
     auto res = static_cast<T>(0);
-    for (const auto& s : split) {
-      const auto r = single_string_to_enum(s);
-      if (r) {
-        res |= static_cast<T>(*r);
-      } else {
+    size_t begin = 0;
+    while (true) {
+      const auto end = _str.find('|', begin);
+      const auto r = single_string_to_enum(_str.substr(begin, end - begin));
+      if (!r) {
         return r;
       }
+      res |= static_cast<T>(*r);
+      if (end == std::string_view::npos) {
+        break;
+      }
+      begin = end + 1;
     }
     return static_cast<EnumType>(res);
   }
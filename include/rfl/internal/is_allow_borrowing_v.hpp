@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_ISALLOWBORROWING_HPP_
+#define RFL_INTERNAL_ISALLOWBORROWING_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "AllowBorrowing.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+class is_allow_borrowing;
+
+template <class T>
+class is_allow_borrowing : public std::false_type {};
+
+template <>
+class is_allow_borrowing<AllowBorrowing> : public std::true_type {};
+
+template <class T>
+constexpr bool is_allow_borrowing_v =
+    is_allow_borrowing<std::remove_cvref_t<std::remove_pointer_t<T>>>::value;
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
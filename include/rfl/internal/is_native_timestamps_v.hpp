@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_ISNATIVETIMESTAMPS_HPP_
+#define RFL_INTERNAL_ISNATIVETIMESTAMPS_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../NativeTimestamps.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+class is_native_timestamps;
+
+template <class T>
+class is_native_timestamps : public std::false_type {};
+
+template <>
+class is_native_timestamps<NativeTimestamps> : public std::true_type {};
+
+template <class T>
+constexpr bool is_native_timestamps_v =
+    is_native_timestamps<std::remove_cvref_t<std::remove_pointer_t<T>>>::value;
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_ISPARALLEL_HPP_
+#define RFL_INTERNAL_ISPARALLEL_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../Parallel.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+class is_parallel;
+
+template <class T>
+class is_parallel : public std::false_type {};
+
+template <>
+class is_parallel<Parallel> : public std::true_type {};
+
+template <class T>
+constexpr bool is_parallel_v =
+    is_parallel<std::remove_cvref_t<std::remove_pointer_t<T>>>::value;
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -2,9 +2,17 @@
 #define RFL_JSON_HPP_
 
 #include "../rfl.hpp"
+#include "json/ArrayReader.hpp"
+#include "json/Context.hpp"
+#include "json/OutputBuffer.hpp"
 #include "json/Parser.hpp"
 #include "json/Reader.hpp"
+#include "json/Streaming.hpp"
+#include "json/StreamingWriter.hpp"
+#include "json/View.hpp"
 #include "json/Writer.hpp"
+#include "json/lines/Reader.hpp"
+#include "json/lines/write.hpp"
 #include "json/load.hpp"
 #include "json/read.hpp"
 #include "json/save.hpp"
@@ -0,0 +1,281 @@
+#ifndef RFL_JSON_ARRAYREADER_HPP_
+#define RFL_JSON_ARRAYREADER_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../thirdparty/yyjson.h"
+#endif
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "../Result.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "Context.hpp"
+#include "read.hpp"
+
+namespace rfl::json {
+
+/// Reads the elements of a top-level JSON array one at a time, without
+/// building a DOM of the entire array or materializing a std::vector<T>:
+///
+///   for (const auto& res : rfl::json::ArrayReader<Record>(stream)) {
+///     ...
+///   }
+///
+/// The reader scans the input just far enough to find where the current
+/// element ends and then parses only that element. When reading from an
+/// std::istream, the input is read in chunks and only the current element
+/// is held in memory.
+///
+/// Each element is a Result<T>. If an element cannot be parsed, the error is
+/// reported with its index and the reader moves on to the next one. If the
+/// input is not a well-formed array or anything but whitespace follows it, an
+/// error is reported and the iteration ends.
+template <class T, class... Ps>
+class ArrayReader {
+  static constexpr size_t chunk_size_ = 65536;
+
+  enum class State { before_array, in_array, after_array, done };
+
+ public:
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ResultType;
+
+    Iterator() = default;
+
+    explicit Iterator(ArrayReader* _reader) : reader_(_reader) {}
+
+    const ResultType& operator*() const { return *reader_->current_; }
+
+    const ResultType* operator->() const { return &*reader_->current_; }
+
+    Iterator& operator++() {
+      reader_->advance();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const noexcept {
+      return !reader_ || !reader_->current_;
+    }
+
+   private:
+    ArrayReader* reader_ = nullptr;
+  };
+
+  explicit ArrayReader(std::istream& _stream, const yyjson_read_flag _flag = 0)
+      : stream_(&_stream), flag_(_flag) {}
+
+  explicit ArrayReader(const std::string_view _json_str,
+                       const yyjson_read_flag _flag = 0)
+      : stream_(nullptr), data_(_json_str), flag_(_flag) {}
+
+  /// Reads the first element. Like any input range, an ArrayReader can only be
+  /// iterated over once.
+  Iterator begin() {
+    if (!started_) {
+      started_ = true;
+      advance();
+    }
+    return Iterator(this);
+  }
+
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+ private:
+  /// Parses the next element into current_ or resets current_, if there are
+  /// no more elements.
+  void advance() {
+    current_.reset();
+
+    if (state_ == State::done) {
+      return;
+    }
+
+    if (state_ == State::after_array) {
+      return finish();
+    }
+
+    if (state_ == State::before_array) {
+      if (!skip_whitespace() || data_[pos_] != '[') {
+        return fail("Expected a JSON array.");
+      }
+      ++pos_;
+      if (!skip_whitespace()) {
+        return fail("Unexpected end of input.");
+      }
+      if (data_[pos_] == ']') {
+        ++pos_;
+        return finish();
+      }
+      state_ = State::in_array;
+    }
+
+    size_t end = 0;
+    if (!find_element_end(&end)) {
+      return fail("Unexpected end of input.");
+    }
+    if (data_[end] == '}') {
+      return fail("Unexpected '}' in element " + std::to_string(index_) + ".");
+    }
+
+    auto element = data_.substr(pos_, end - pos_);
+    while (!element.empty() && is_whitespace(element.back())) {
+      element.remove_suffix(1);
+    }
+
+    auto res = json::read<T, Ps...>(element, ctx_, flag_);
+    if (res) {
+      current_.emplace(std::move(res));
+    } else {
+      current_.emplace(error("Element " + std::to_string(index_) + ": " +
+                             res.error().what()));
+    }
+
+    ++index_;
+    if (data_[end] == ']') {
+      state_ = State::after_array;
+    }
+    pos_ = end + 1;
+
+    if (state_ == State::in_array) {
+      skip_whitespace();
+    }
+  }
+
+  /// Finds the ',' or closing bracket that terminates the element starting at
+  /// pos_.
+  bool find_element_end(size_t* _end) {
+    size_t depth = 0;
+    bool in_string = false;
+    bool escaped = false;
+    for (size_t i = pos_;; ++i) {
+      if (i >= data_.size()) {
+        const auto offset = pos_;
+        if (!refill()) {
+          return false;
+        }
+        i -= offset;
+      }
+      const char c = data_[i];
+      if (in_string) {
+        if (escaped) {
+          escaped = false;
+        } else if (c == '\\') {
+          escaped = true;
+        } else if (c == '"') {
+          in_string = false;
+        }
+      } else if (c == '"') {
+        in_string = true;
+      } else if (c == '[' || c == '{') {
+        ++depth;
+      } else if (c == ']' || c == '}') {
+        if (depth == 0) {
+          *_end = i;
+          return true;
+        }
+        --depth;
+      } else if (c == ',' && depth == 0) {
+        *_end = i;
+        return true;
+      }
+    }
+  }
+
+  /// Advances pos_ to the next non-whitespace character. Returns false, if
+  /// the end of the input has been reached.
+  bool skip_whitespace() {
+    while (true) {
+      if (pos_ >= data_.size() && !refill()) {
+        return false;
+      }
+      if (!is_whitespace(data_[pos_])) {
+        return true;
+      }
+      ++pos_;
+    }
+  }
+
+  /// Discards everything before pos_ and reads the next chunk from the
+  /// stream. Afterwards, pos_ is 0. Returns false, if nothing could be read.
+  bool refill() {
+    if (!stream_) {
+      return false;
+    }
+    buf_.erase(0, pos_);
+    pos_ = 0;
+    const auto old_size = buf_.size();
+    buf_.resize(old_size + chunk_size_);
+    stream_->read(buf_.data() + old_size, chunk_size_);
+    buf_.resize(old_size + static_cast<size_t>(stream_->gcount()));
+    data_ = buf_;
+    return buf_.size() > old_size;
+  }
+
+  /// Makes sure nothing but whitespace follows the array.
+  void finish() {
+    state_ = State::done;
+    if (skip_whitespace()) {
+      fail("Unexpected content after the end of the array.");
+    }
+  }
+
+  void fail(const std::string& _msg) {
+    current_.emplace(error(_msg));
+    state_ = State::done;
+  }
+
+  static bool is_whitespace(const char _c) noexcept {
+    return _c == ' ' || _c == '\n' || _c == '\r' || _c == '\t';
+  }
+
+ private:
+  /// The stream we read from or nullptr, if we read from a buffer.
+  std::istream* stream_;
+
+  /// Holds the data read from the stream.
+  std::string buf_;
+
+  /// The data we are currently scanning, either the buffer passed by the user
+  /// or buf_.
+  std::string_view data_;
+
+  /// The position of the first character in data_ that has not been
+  /// consumed yet.
+  size_t pos_ = 0;
+
+  /// Reused for parsing all of the elements.
+  Context ctx_;
+
+  /// The element the iterators point to.
+  std::optional<ResultType> current_;
+
+  /// The index of the next element.
+  size_t index_ = 0;
+
+  /// How far we have gotten.
+  State state_ = State::before_array;
+
+  /// The flag passed to yyjson.
+  yyjson_read_flag flag_;
+
+  /// Whether the first element has already been read.
+  bool started_ = false;
+};
+
+}  // namespace rfl::json
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef RFL_JSON_CONTEXT_HPP_
+#define RFL_JSON_CONTEXT_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../thirdparty/yyjson.h"
+#endif
+
+#include <string>
+
+namespace rfl {
+namespace json {
+
+/// Holds the memory used by read(...) and write(...), so it can be reused
+/// across calls instead of being allocated and freed every time. Documents
+/// are parsed using a yyjson dynamic allocator, which keeps the memory of
+/// freed documents around for the next one, and JSON strings are written
+/// into a buffer that keeps its capacity.
+///
+/// A Context is not thread-safe, but it is cheap enough to keep one per
+/// thread:
+///
+///   thread_local auto ctx = rfl::json::Context();
+///   const auto json_str = rfl::json::write(obj, ctx);
+///   const auto res = rfl::json::read<T>(json_str, ctx);
+class Context {
+ public:
+  Context();
+
+  Context(const Context&) = delete;
+
+  Context(Context&& _other) noexcept;
+
+  ~Context();
+
+  Context& operator=(const Context&) = delete;
+
+  Context& operator=(Context&& _other) noexcept;
+
+  /// The allocator used for parsing documents.
+  const yyjson_alc* allocator() const noexcept { return alc_; }
+
+  /// The buffer the JSON strings are written into.
+  std::string* buffer() noexcept { return &buffer_; }
+
+ private:
+  /// The dynamic allocator, owned by the context.
+  yyjson_alc* alc_;
+
+  /// The output buffer.
+  std::string buffer_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
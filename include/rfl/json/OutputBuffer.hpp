@@ -0,0 +1,123 @@
+#ifndef RFL_JSON_OUTPUTBUFFER_HPP_
+#define RFL_JSON_OUTPUTBUFFER_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace rfl {
+namespace json {
+
+/// The memory the StreamingWriter writes into. This is either a std::string,
+/// which is appended to and grows as needed, a fixed buffer provided by the
+/// caller or a small chunk, which is flushed to a std::ostream whenever it is
+/// full. If a fixed buffer is too small, the output is truncated, but the size
+/// is still counted, so the caller knows how much memory is needed.
+class OutputBuffer {
+ public:
+  /// Appends to _str, reusing its existing capacity.
+  explicit OutputBuffer(std::string* _str);
+
+  /// Writes into _buf.
+  explicit OutputBuffer(std::span<char> _buf);
+
+  /// Writes to _stream in chunks, so the output is never held in memory as a
+  /// whole.
+  explicit OutputBuffer(std::ostream* _stream);
+
+  OutputBuffer(const OutputBuffer&) = delete;
+
+  OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+  void append(const char* _data, const size_t _size) {
+    if (size_ + _size > capacity_ && !grow(_size)) [[unlikely]] {
+      char* const dest = data_ + size_;
+      std::memcpy(dest, _data, truncate(_size));
+      return;
+    }
+    std::memcpy(data_ + size_, _data, _size);
+    size_ += _size;
+  }
+
+  void append(const std::string_view _str) { append(_str.data(), _str.size()); }
+
+  void append(const size_t _count, const char _c) {
+    if (size_ + _count > capacity_ && !grow(_count)) [[unlikely]] {
+      char* const dest = data_ + size_;
+      std::memset(dest, _c, truncate(_count));
+      return;
+    }
+    std::memset(data_ + size_, _c, _count);
+    size_ += _count;
+  }
+
+  void push_back(const char _c) {
+    if (size_ >= capacity_ && !grow(1)) [[unlikely]] {
+      ++size_;
+      return;
+    }
+    data_[size_++] = _c;
+  }
+
+  /// Must be called once writing is done. If we are writing into a
+  /// std::string, it is shrunk to the size of its content, and if we are
+  /// writing to a stream, whatever is left in the chunk is flushed. Returns
+  /// the size of the content, which, for a fixed buffer, may be larger than
+  /// the buffer itself, if the output was truncated.
+  size_t finish();
+
+ private:
+  /// Makes room for at least _additional more bytes. Returns false, if that
+  /// is impossible, because this is a fixed buffer.
+  bool grow(const size_t _additional);
+
+  /// Writes the chunk to the stream and empties it.
+  void flush();
+
+  /// Called when _size more bytes do not fit into a fixed buffer. Counts all
+  /// of them, but returns how many of them can still be written.
+  size_t truncate(const size_t _size) noexcept {
+    const auto fits = size_ < capacity_ ? capacity_ - size_ : 0;
+    size_ += _size;
+    return fits;
+  }
+
+ private:
+  /// The smallest number of bytes a std::string is resized to, so that
+  /// writing into an empty string does not start out with tiny steps.
+  static constexpr size_t min_growth_ = 64;
+
+  /// The size of the chunk used for writing to a stream.
+  static constexpr size_t chunk_size_ = 4096;
+
+  /// The string we append to or nullptr, if this is not a std::string.
+  std::string* str_;
+
+  /// The stream we write to or nullptr, if this is not a stream.
+  std::ostream* stream_;
+
+  /// The chunk that is flushed to stream_.
+  std::unique_ptr<char[]> chunk_;
+
+  /// The number of bytes that have already been flushed to stream_.
+  size_t flushed_;
+
+  /// The memory we write into.
+  char* data_;
+
+  /// The number of bytes written (or, if truncated, that would have been
+  /// written).
+  size_t size_;
+
+  /// The number of bytes that fit into data_.
+  size_t capacity_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "../parsing/NodeKind.hpp"
 
 namespace rfl {
 namespace json {
@@ -47,6 +48,9 @@ struct Reader {
   using InputObjectType = YYJSONInputObject;
   using InputVarType = YYJSONInputVar;
 
+  /// The document is never modified while reading.
+  static constexpr bool supports_parallel_reading = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_json_obj(var); });
@@ -69,10 +73,42 @@ struct Reader {
     return var;
   }
 
+  bool has_field(const std::string_view _name,
+                 const InputObjectType _obj) const noexcept {
+    return yyjson_obj_getn(_obj.val_, _name.data(), _name.size()) != nullptr;
+  }
+
   bool is_empty(const InputVarType _var) const noexcept {
     return !_var.val_ || yyjson_is_null(_var.val_);
   }
 
+  parsing::NodeKind node_kind(const InputVarType _var) const noexcept {
+    switch (yyjson_get_type(_var.val_)) {
+      case YYJSON_TYPE_NULL:
+        return parsing::NodeKind::null;
+      case YYJSON_TYPE_BOOL:
+        return parsing::NodeKind::boolean;
+      case YYJSON_TYPE_NUM:
+        return parsing::NodeKind::number;
+      case YYJSON_TYPE_STR:
+        return parsing::NodeKind::string;
+      case YYJSON_TYPE_ARR:
+        return parsing::NodeKind::array;
+      case YYJSON_TYPE_OBJ:
+        return parsing::NodeKind::object;
+      default:
+        return parsing::NodeKind::unknown;
+    }
+  }
+
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return yyjson_arr_size(_arr.val_);
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return yyjson_obj_size(_obj.val_);
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
@@ -101,6 +137,15 @@ struct Reader {
     return std::nullopt;
   }
 
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType _var) const noexcept {
+    const auto r = yyjson_get_str(_var.val_);
+    if (r == NULL) {
+      return error("Could not cast to string.");
+    }
+    return std::string_view(r, yyjson_get_len(_var.val_));
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
@@ -0,0 +1,28 @@
+#ifndef RFL_JSON_STREAMING_HPP_
+#define RFL_JSON_STREAMING_HPP_
+
+#include <type_traits>
+
+namespace rfl::json {
+
+/// This is a "fake" processor - it doesn't do anything to the fields, but
+/// passing it to json::write(...) or json::save(...) selects the
+/// StreamingWriter, which writes the JSON directly into a buffer instead of
+/// building a yyjson document first:
+///
+///   rfl::json::write<rfl::json::Streaming>(obj, rfl::json::pretty);
+struct Streaming {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+template <class... Ps>
+constexpr bool is_streaming_v =
+    std::disjunction_v<std::is_same<std::remove_cvref_t<Ps>, Streaming>...>;
+
+}  // namespace rfl::json
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef RFL_JSON_STREAMINGWRITER_HPP_
+#define RFL_JSON_STREAMINGWRITER_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../thirdparty/yyjson.h"
+#endif
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../always_false.hpp"
+#include "OutputBuffer.hpp"
+
+namespace rfl {
+namespace json {
+
+/// An alternative to json::Writer, which does not build a yyjson document, but
+/// appends the JSON directly to a buffer as the parser walks through the
+/// object. This avoids holding the entire document in memory twice.
+///
+/// The formatting options are taken from the same yyjson_write_flag as
+/// yyjson_mut_write, supporting YYJSON_WRITE_PRETTY,
+/// YYJSON_WRITE_PRETTY_TWO_SPACES, YYJSON_WRITE_ESCAPE_UNICODE,
+/// YYJSON_WRITE_ESCAPE_SLASHES and YYJSON_WRITE_ALLOW_INF_AND_NAN. Because the
+/// writer cannot fail halfway through, NaN and infinity are written as null,
+/// unless YYJSON_WRITE_ALLOW_INF_AND_NAN is passed. Strings are not validated,
+/// they are assumed to be valid UTF-8.
+class StreamingWriter {
+ public:
+  struct StreamingOutputArray {
+    size_t depth_;
+    bool empty_ = true;
+  };
+
+  struct StreamingOutputObject {
+    size_t depth_;
+    bool empty_ = true;
+  };
+
+  struct StreamingOutputVar {};
+
+  using OutputArrayType = StreamingOutputArray;
+  using OutputObjectType = StreamingOutputObject;
+  using OutputVarType = StreamingOutputVar;
+
+  StreamingWriter(OutputBuffer* _buffer, const yyjson_write_flag _flag = 0);
+
+  OutputArrayType array_as_root(const size_t) const noexcept;
+
+  OutputObjectType object_as_root(const size_t) const noexcept;
+
+  OutputVarType null_as_root() const noexcept;
+
+  template <class T>
+  OutputVarType value_as_root(const T& _var) const noexcept {
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  OutputArrayType add_array_to_array(const size_t,
+                                     OutputArrayType* _parent) const noexcept;
+
+  OutputArrayType add_array_to_object(const std::string_view& _name,
+                                      const size_t,
+                                      OutputObjectType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_array(const size_t,
+                                       OutputArrayType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_object(
+      const std::string_view& _name, const size_t,
+      OutputObjectType* _parent) const noexcept;
+
+  template <class T>
+  OutputVarType add_value_to_array(const T& _var,
+                                   OutputArrayType* _parent) const noexcept {
+    begin_element(_parent);
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const std::string_view& _name,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    begin_field(_name, _parent);
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
+
+  OutputVarType add_null_to_object(const std::string_view& _name,
+                                   OutputObjectType* _parent) const noexcept;
+
+  void end_array(OutputArrayType* _arr) const noexcept;
+
+  void end_object(OutputObjectType* _obj) const noexcept;
+
+ private:
+  /// Writes the separator and indentation preceding a new array element.
+  void begin_element(OutputArrayType* _parent) const noexcept;
+
+  /// Writes the separator, indentation and key preceding a new field.
+  void begin_field(const std::string_view& _name,
+                   OutputObjectType* _parent) const noexcept;
+
+  /// Writes the closing bracket or brace of a container at _depth.
+  void end_container(const size_t _depth, const bool _empty,
+                     const char _close) const noexcept;
+
+  void write_indent(const size_t _depth) const noexcept;
+
+  void write_string(const std::string_view _str) const noexcept;
+
+  void write_double(const double _val) const noexcept;
+
+  template <class T>
+  void write_basic_type(const T& _var) const noexcept {
+    using Type = std::remove_cvref_t<T>;
+    if constexpr (std::is_same<Type, std::string>() ||
+                  std::is_same<Type, std::string_view>()) {
+      write_string(_var);
+    } else if constexpr (std::is_same<Type, bool>()) {
+      buffer_->append(_var ? "true" : "false");
+    } else if constexpr (std::is_floating_point<Type>()) {
+      write_double(static_cast<double>(_var));
+    } else if constexpr (std::is_integral<Type>()) {
+      char buf[24];
+      const auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), _var);
+      buffer_->append(buf, ptr - buf);
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+  }
+
+ private:
+  /// The buffer the JSON is appended to.
+  OutputBuffer* buffer_;
+
+  /// The number of spaces per level of indentation, 0 for compact output.
+  size_t indent_;
+
+  /// Determines which characters are escaped and how, depending on
+  /// YYJSON_WRITE_ESCAPE_UNICODE and YYJSON_WRITE_ESCAPE_SLASHES.
+  const char* escape_table_;
+
+  /// Whether NaN and infinity should be written as NaN and (-)Infinity rather
+  /// than null.
+  bool allow_inf_and_nan_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
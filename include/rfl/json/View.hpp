@@ -0,0 +1,144 @@
+#ifndef RFL_JSON_VIEW_HPP_
+#define RFL_JSON_VIEW_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../thirdparty/yyjson.h"
+#endif
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../Processors.hpp"
+#include "../Result.hpp"
+#include "../Tuple.hpp"
+#include "../internal/StringLiteral.hpp"
+#include "../internal/find_index.hpp"
+#include "../internal/is_extra_fields.hpp"
+#include "../internal/processed_t.hpp"
+#include "../named_tuple_t.hpp"
+#include "../parsing/is_required.hpp"
+#include "Parser.hpp"
+#include "Reader.hpp"
+
+namespace rfl::json {
+
+/// Keeps a parsed JSON document and only decodes the fields of T that are
+/// actually accessed. This pays off when only a few fields of a large message
+/// are needed:
+///
+///   auto view = rfl::json::read_view<Message>(json_str).value();
+///   const auto& route = view.get<"route">().value();
+///
+/// Each field is decoded at most once, the result (or the error) is cached.
+/// Fields are referred to by the same names as in
+/// rfl::get<"name">(rfl::to_named_tuple(obj)). Any processors passed as Ps
+/// are applied as usual, so, for instance, with rfl::SnakeCaseToCamelCase,
+/// view.get<"first_name">() reads the key "firstName".
+///
+/// Because get() updates the cache, a View is not thread-safe.
+template <class T, class... Ps>
+class View {
+  using ProcessorsType = Processors<Ps...>;
+
+  using NamedTupleType = named_tuple_t<T>;
+
+  using ProcessedType = internal::processed_t<T, ProcessorsType>;
+
+  using Fields = typename NamedTupleType::Fields;
+
+  /// Processors like rfl::AddStructName prepend fields, so the fields of T
+  /// start at this position in ProcessedType.
+  static constexpr int offset_ =
+      static_cast<int>(ProcessedType::size() - NamedTupleType::size());
+
+  template <int _i>
+  using ValueType =
+      std::remove_cvref_t<typename tuple_element_t<_i, Fields>::Type>;
+
+  template <int... _is>
+  static auto make_cache(std::integer_sequence<int, _is...>)
+      -> std::tuple<std::optional<Result<ValueType<_is>>>...>;
+
+  using CacheType = decltype(make_cache(
+      std::make_integer_sequence<int, NamedTupleType::size()>()));
+
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for views.");
+
+ public:
+  /// Use json::read_view(...) instead.
+  View(std::shared_ptr<const yyjson_doc> _doc, yyjson_val* _root)
+      : doc_(std::move(_doc)), root_(_root) {}
+
+  /// Decodes the field the first time it is accessed and returns the cached
+  /// result afterwards.
+  template <internal::StringLiteral _field_name>
+  const auto& get() {
+    constexpr int ix = internal::find_index<_field_name, Fields>();
+    auto& cached = std::get<ix>(cache_);
+    if (!cached) {
+      cached.emplace(decode<ix>());
+    }
+    return *cached;
+  }
+
+  /// Whether the field has already been decoded.
+  template <internal::StringLiteral _field_name>
+  bool is_decoded() const noexcept {
+    constexpr int ix = internal::find_index<_field_name, Fields>();
+    return std::get<ix>(cache_).has_value();
+  }
+
+ private:
+  template <int _i>
+  Result<ValueType<_i>> decode() const {
+    using U = ValueType<_i>;
+    static_assert(!internal::is_extra_fields_v<U>,
+                  "rfl::ExtraFields are not supported for views.");
+
+    constexpr auto name =
+        tuple_element_t<_i + offset_, typename ProcessedType::Fields>::name();
+
+    yyjson_val* val = yyjson_obj_getn(root_, name.data(), name.size());
+
+    if (!val) {
+      constexpr bool is_required_field =
+          !ProcessorsType::default_if_missing_ &&
+          (ProcessorsType::all_required_ ||
+           parsing::is_required<U, /*_ignore_empty_containers=*/false>());
+      if constexpr (is_required_field) {
+        return error("Field named '" + std::string(name) + "' not found.");
+      } else {
+        return U();
+      }
+    }
+
+    const auto r = Reader();
+    auto res = Parser<U, ProcessorsType>::read(r, Reader::InputVarType(val));
+    if (!res) {
+      return error("Failed to parse field '" + std::string(name) +
+                   "': " + res.error().what());
+    }
+    return res;
+  }
+
+ private:
+  /// The document, which is shared between copies of the view.
+  std::shared_ptr<const yyjson_doc> doc_;
+
+  /// The root object of the document.
+  yyjson_val* root_;
+
+  /// The decoded fields.
+  CacheType cache_;
+};
+
+}  // namespace rfl::json
+
+#endif
@@ -18,6 +18,7 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "../parsing/StaticName.hpp"
 
 namespace rfl {
 namespace json {
@@ -70,6 +71,10 @@ class Writer {
                                       const size_t,
                                       OutputObjectType* _parent) const noexcept;
 
+  OutputArrayType add_array_to_object(const parsing::StaticName& _name,
+                                      const size_t,
+                                      OutputObjectType* _parent) const noexcept;
+
   OutputObjectType add_object_to_array(const size_t,
                                        OutputArrayType* _parent) const noexcept;
 
@@ -77,6 +82,10 @@ class Writer {
       const std::string_view& _name, const size_t,
       OutputObjectType* _parent) const noexcept;
 
+  OutputObjectType add_object_to_object(
+      const parsing::StaticName& _name, const size_t,
+      OutputObjectType* _parent) const noexcept;
+
   template <class T>
   OutputVarType add_value_to_array(const T& _var,
                                    OutputArrayType* _parent) const noexcept {
@@ -90,8 +99,16 @@ class Writer {
                                     const T& _var,
                                     OutputObjectType* _parent) const noexcept {
     const auto val = from_basic_type(_var);
-    yyjson_mut_obj_add(_parent->val_, yyjson_mut_strcpy(doc_, _name.data()),
-                       val.val_);
+    yyjson_mut_obj_add(_parent->val_, copy_key(_name), val.val_);
+    return OutputVarType(val);
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const parsing::StaticName& _name,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    const auto val = from_basic_type(_var);
+    yyjson_mut_obj_add(_parent->val_, reference_key(_name), val.val_);
     return OutputVarType(val);
   }
 
@@ -100,15 +117,33 @@ class Writer {
   OutputVarType add_null_to_object(const std::string_view& _name,
                                    OutputObjectType* _parent) const noexcept;
 
+  OutputVarType add_null_to_object(const parsing::StaticName& _name,
+                                   OutputObjectType* _parent) const noexcept;
+
   void end_array(OutputArrayType*) const noexcept;
 
   void end_object(OutputObjectType*) const noexcept;
 
  private:
+  /// Keys that are only known at runtime might not outlive the writer, so
+  /// they must be copied into the document.
+  yyjson_mut_val* copy_key(const std::string_view& _name) const noexcept {
+    return yyjson_mut_strncpy(doc_, _name.data(), _name.size());
+  }
+
+  /// Static names live for the duration of the program, so the document can
+  /// simply point to them.
+  yyjson_mut_val* reference_key(
+      const parsing::StaticName& _name) const noexcept {
+    return yyjson_mut_strn(doc_, _name.str_.data(), _name.str_.size());
+  }
+
   template <class T>
   OutputVarType from_basic_type(const T& _var) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      return OutputVarType(yyjson_mut_strcpy(doc_, _var.c_str()));
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      return OutputVarType(
+          yyjson_mut_strncpy(doc_, _var.data(), _var.size()));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       return OutputVarType(yyjson_mut_bool(doc_, _var));
     } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
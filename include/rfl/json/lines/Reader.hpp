@@ -0,0 +1,175 @@
+#ifndef RFL_JSON_LINES_READER_HPP_
+#define RFL_JSON_LINES_READER_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../../thirdparty/yyjson.h"
+#endif
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "../../Result.hpp"
+#include "../../internal/wrap_in_rfl_array_t.hpp"
+#include "../Context.hpp"
+#include "../read.hpp"
+
+namespace rfl::json::lines {
+
+/// Reads newline-delimited JSON (also known as NDJSON or JSON Lines) one
+/// line at a time, either from an std::istream or from a buffer in memory.
+/// Only a single line is held in memory at any time, so the memory
+/// consumption is bounded by the longest line, not the size of the input.
+/// Blank lines are ignored.
+///
+///   for (const auto& res : rfl::json::lines::Reader<Event>(stream)) {
+///     ...
+///   }
+///
+/// Each element is a Result<T>. Parsing errors are reported with the line
+/// number they occurred on. If _skip_errors is set, lines that cannot be
+/// parsed are skipped instead.
+template <class T, class... Ps>
+class Reader {
+ public:
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ResultType;
+
+    Iterator() = default;
+
+    explicit Iterator(Reader* _reader) : reader_(_reader) {}
+
+    const ResultType& operator*() const { return *reader_->current_; }
+
+    const ResultType* operator->() const { return &*reader_->current_; }
+
+    Iterator& operator++() {
+      reader_->advance();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const noexcept {
+      return !reader_ || !reader_->current_;
+    }
+
+   private:
+    Reader* reader_ = nullptr;
+  };
+
+  explicit Reader(std::istream& _stream, const bool _skip_errors = false,
+                  const yyjson_read_flag _flag = 0)
+      : stream_(&_stream), skip_errors_(_skip_errors), flag_(_flag) {}
+
+  explicit Reader(const std::string_view _buffer,
+                  const bool _skip_errors = false,
+                  const yyjson_read_flag _flag = 0)
+      : stream_(nullptr),
+        buffer_(_buffer),
+        skip_errors_(_skip_errors),
+        flag_(_flag) {}
+
+  /// Reads the first element. Like any input range, a Reader can only be
+  /// iterated over once.
+  Iterator begin() {
+    if (!started_) {
+      started_ = true;
+      advance();
+    }
+    return Iterator(this);
+  }
+
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+  /// The line the current element was read from, starting at 1.
+  size_t line_number() const noexcept { return line_number_; }
+
+ private:
+  /// Parses the next non-blank line into current_ or resets current_, if
+  /// there are no more lines.
+  void advance() {
+    current_.reset();
+    std::string_view line;
+    while (next_line(&line)) {
+      ++line_number_;
+      if (line.find_first_not_of(" \t\r") == std::string_view::npos) {
+        continue;
+      }
+      auto res = json::read<T, Ps...>(line, ctx_, flag_);
+      if (res) {
+        current_.emplace(std::move(res));
+        return;
+      }
+      if (!skip_errors_) {
+        current_.emplace(error("Line " + std::to_string(line_number_) + ": " +
+                               res.error().what()));
+        return;
+      }
+    }
+  }
+
+  /// Retrieves the next line, without the line break.
+  bool next_line(std::string_view* _line) {
+    if (stream_) {
+      if (!std::getline(*stream_, line_)) {
+        return false;
+      }
+      *_line = line_;
+    } else {
+      if (buffer_.empty()) {
+        return false;
+      }
+      const auto pos = buffer_.find('\n');
+      *_line = buffer_.substr(0, pos);
+      buffer_.remove_prefix(pos == std::string_view::npos ? buffer_.size()
+                                                          : pos + 1);
+    }
+    if (!_line->empty() && _line->back() == '\r') {
+      _line->remove_suffix(1);
+    }
+    return true;
+  }
+
+ private:
+  /// The stream we read from or nullptr, if we read from the buffer.
+  std::istream* stream_;
+
+  /// The part of the buffer that has not been read yet.
+  std::string_view buffer_;
+
+  /// The current line, when reading from a stream.
+  std::string line_;
+
+  /// Reused for parsing all of the lines.
+  Context ctx_;
+
+  /// The element the iterators point to.
+  std::optional<ResultType> current_;
+
+  /// The line current_ was read from.
+  size_t line_number_ = 0;
+
+  /// Whether lines that cannot be parsed should be skipped.
+  bool skip_errors_;
+
+  /// The flag passed to yyjson.
+  yyjson_read_flag flag_;
+
+  /// Whether the first element has already been read.
+  bool started_ = false;
+};
+
+}  // namespace rfl::json::lines
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef RFL_JSON_LINES_WRITE_HPP_
+#define RFL_JSON_LINES_WRITE_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../../thirdparty/yyjson.h"
+#endif
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "../Context.hpp"
+#include "../write.hpp"
+
+namespace rfl::json::lines {
+
+/// Writes each element of _range as a single line of JSON (also known as
+/// NDJSON or JSON Lines). Flags that would introduce additional line breaks,
+/// such as pretty printing, are ignored.
+template <class... Ps>
+std::ostream& write(const auto& _range, std::ostream& _stream,
+                    const yyjson_write_flag _flag = 0) {
+  const auto flag = _flag & ~(YYJSON_WRITE_PRETTY |
+                              YYJSON_WRITE_PRETTY_TWO_SPACES |
+                              YYJSON_WRITE_NEWLINE_AT_END);
+  auto ctx = Context();
+  for (const auto& obj : _range) {
+    _stream << json::write<Ps...>(obj, ctx, flag) << '\n';
+  }
+  return _stream;
+}
+
+/// Returns each element of _range as a single line of JSON.
+template <class... Ps>
+std::string write(const auto& _range, const yyjson_write_flag _flag = 0) {
+  std::stringstream stream;
+  write<Ps...>(_range, stream, _flag);
+  return stream.str();
+}
+
+}  // namespace rfl::json::lines
+
+#endif
@@ -7,13 +7,20 @@
 #include "../thirdparty/yyjson.h"
 #endif
 
+#include <cstring>
 #include <istream>
+#include <memory>
 #include <string_view>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
+#include "../internal/AllowBorrowing.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
+#include "Context.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
+#include "View.hpp"
 
 namespace rfl {
 namespace json {
@@ -43,6 +50,51 @@ Result<internal::wrap_in_rfl_array_t<T>> read(
   return res;
 }
 
+/// Parses an object from JSON using reflection. The document is allocated
+/// using the memory held by _ctx, which is reused across calls.
+template <class T, class... Ps>
+Result<internal::wrap_in_rfl_array_t<T>> read(const std::string_view _json_str,
+                                              Context& _ctx,
+                                              const yyjson_read_flag _flag = 0) {
+  // Like yyjson_read(...), we must never modify the input.
+  yyjson_doc* doc = yyjson_read_opts(const_cast<char*>(_json_str.data()),
+                                     _json_str.size(),
+                                     _flag & ~YYJSON_READ_INSITU,
+                                     _ctx.allocator(), NULL);
+  if (!doc) {
+    return error("Could not parse document");
+  }
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  const auto r = Reader();
+  auto res = Parser<T, Processors<Ps...>>::read(r, InputVarType(root));
+  yyjson_doc_free(doc);
+  return res;
+}
+
+/// Parses an object from JSON in situ, meaning that yyjson does not copy the
+/// input, but parses it directly inside the buffer, which it may modify.
+///
+/// The buffer must be mutable and padded: _data must point to at least
+/// _len + YYJSON_PADDING_SIZE writable bytes, the first _len of which contain
+/// the JSON. The padding bytes are overwritten with zeros. After the call, the
+/// content of the buffer is unspecified, but the result does not reference it,
+/// so the buffer can be reused immediately.
+template <class T, class... Ps>
+Result<internal::wrap_in_rfl_array_t<T>> read_insitu(
+    char* _data, const size_t _len, const yyjson_read_flag _flag = 0) {
+  std::memset(_data + _len, 0, YYJSON_PADDING_SIZE);
+  yyjson_doc* doc = yyjson_read_opts(_data, _len, _flag | YYJSON_READ_INSITU,
+                                     NULL, NULL);
+  if (!doc) {
+    return error("Could not parse document");
+  }
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  const auto r = Reader();
+  auto res = Parser<T, Processors<Ps...>>::read(r, InputVarType(root));
+  yyjson_doc_free(doc);
+  return res;
+}
+
 /// Parses an object from a stringstream.
 template <class T, class... Ps>
 auto read(std::istream& _stream) {
@@ -51,6 +103,76 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(json_str);
 }
 
+/// Parses a JSON var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const InputVarType& _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses JSON into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::string_view _json_str,
+                          const yyjson_read_flag _flag = 0) {
+  yyjson_doc* doc = yyjson_read(_json_str.data(), _json_str.size(), _flag);
+  if (!doc) {
+    return error("Could not parse document");
+  }
+  auto res = read_into<Ps...>(_target, InputVarType(yyjson_doc_get_root(doc)));
+  yyjson_doc_free(doc);
+  return res;
+}
+
+/// Parses an object from JSON in borrowing mode: Any std::string_view fields
+/// point directly into the parsed document instead of being copied. The
+/// document is kept alive by the returned rfl::Borrowed.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    const std::string_view _json_str, const yyjson_read_flag _flag = 0) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  yyjson_doc* doc = yyjson_read(_json_str.data(), _json_str.size(), _flag);
+  if (!doc) {
+    return error("Could not parse document");
+  }
+  const auto owner = std::shared_ptr<const yyjson_doc>(
+      doc, [](yyjson_doc* _doc) { yyjson_doc_free(_doc); });
+  const auto to_borrowed = [&](U&& _value) {
+    return Borrowed<U>(std::move(_value), owner);
+  };
+  const auto r = Reader();
+  return Parser<T, Processors<internal::AllowBorrowing, Ps...>>::read(
+             r, InputVarType(yyjson_doc_get_root(doc)))
+      .transform(to_borrowed);
+}
+
+/// Parses JSON into a View, which only decodes the fields of T when they are
+/// accessed.
+template <class T, class... Ps>
+Result<View<T, Ps...>> read_view(const std::string_view _json_str,
+                                 const yyjson_read_flag _flag = 0) {
+  yyjson_doc* doc = yyjson_read(_json_str.data(), _json_str.size(), _flag);
+  if (!doc) {
+    return error("Could not parse document");
+  }
+  const auto owner = std::shared_ptr<const yyjson_doc>(
+      doc, [](yyjson_doc* _doc) { yyjson_doc_free(_doc); });
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  if (!yyjson_is_obj(root)) {
+    return error("Could not cast to object!");
+  }
+  return View<T, Ps...>(owner, root);
+}
+
 }  // namespace json
 }  // namespace rfl
 
@@ -7,13 +7,20 @@
 #include "../thirdparty/yyjson.h"
 #endif
 
+#include <cstddef>
 #include <ostream>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 #include "../Processors.hpp"
 #include "../parsing/Parent.hpp"
+#include "Context.hpp"
+#include "OutputBuffer.hpp"
 #include "Parser.hpp"
+#include "Streaming.hpp"
+#include "StreamingWriter.hpp"
 
 namespace rfl {
 namespace json {
@@ -21,33 +28,115 @@ namespace json {
 /// Convenient alias for the YYJSON pretty flag
 inline constexpr yyjson_write_flag pretty = YYJSON_WRITE_PRETTY;
 
+/// Writes the JSON into _buffer using the StreamingWriter.
+template <class... Ps>
+void write_streaming(const auto& _obj, const yyjson_write_flag _flag,
+                     OutputBuffer* _buffer) {
+  using T = std::remove_cvref_t<decltype(_obj)>;
+  using ParentType = parsing::Parent<StreamingWriter>;
+  const auto w = StreamingWriter(_buffer, _flag);
+  parsing::Parser<Reader, StreamingWriter, T, Processors<Ps...>>::write(
+      w, _obj, typename ParentType::Root{});
+  if (_flag & YYJSON_WRITE_NEWLINE_AT_END) {
+    _buffer->push_back('\n');
+  }
+}
+
+/// Appends the JSON to _str using the StreamingWriter.
+template <class... Ps>
+void write_streaming(const auto& _obj, const yyjson_write_flag _flag,
+                     std::string* _str) {
+  auto buffer = OutputBuffer(_str);
+  write_streaming<Ps...>(_obj, _flag, &buffer);
+  buffer.finish();
+}
+
 /// Returns a JSON string.
 template <class... Ps>
 std::string write(const auto& _obj, const yyjson_write_flag _flag = 0) {
-  using T = std::remove_cvref_t<decltype(_obj)>;
-  using ParentType = parsing::Parent<Writer>;
-  auto w = Writer(yyjson_mut_doc_new(NULL));
-  Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
-  const char* json_c_str = yyjson_mut_write(w.doc_, _flag, NULL);
-  const auto json_str = std::string(json_c_str);
-  free((void*)json_c_str);
-  yyjson_mut_doc_free(w.doc_);
-  return json_str;
+  if constexpr (is_streaming_v<Ps...>) {
+    std::string json_str;
+    write_streaming<Ps...>(_obj, _flag, &json_str);
+    return json_str;
+  } else {
+    using T = std::remove_cvref_t<decltype(_obj)>;
+    using ParentType = parsing::Parent<Writer>;
+    auto w = Writer(yyjson_mut_doc_new(NULL));
+    Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
+    const char* json_c_str = yyjson_mut_write(w.doc_, _flag, NULL);
+    const auto json_str = std::string(json_c_str);
+    free((void*)json_c_str);
+    yyjson_mut_doc_free(w.doc_);
+    return json_str;
+  }
+}
+
+/// Writes the JSON into the buffer held by _ctx, reusing its capacity, and
+/// returns a view of it. The view is invalidated by the next call to write(...)
+/// using the same context.
+///
+/// This always uses the StreamingWriter, which cannot fail halfway through.
+/// Unlike write(_obj), which fails on these, it writes NaN and infinity as
+/// null, unless YYJSON_WRITE_ALLOW_INF_AND_NAN is passed, and copies invalid
+/// UTF-8 as is.
+template <class... Ps>
+std::string_view write(const auto& _obj, Context& _ctx,
+                       const yyjson_write_flag _flag = 0) {
+  _ctx.buffer()->clear();
+  write_streaming<Ps...>(_obj, _flag, _ctx.buffer());
+  return *_ctx.buffer();
+}
+
+/// Appends the JSON to _out. Any capacity _out already has is reused, so
+/// calling this repeatedly with the same string avoids allocations altogether,
+/// once the string is large enough.
+///
+/// Like write(_obj, _ctx), this uses the StreamingWriter, so NaN and infinity
+/// are written as null, unless YYJSON_WRITE_ALLOW_INF_AND_NAN is passed, and
+/// invalid UTF-8 is copied as is, where write(_obj) would fail.
+template <class... Ps>
+void write_to(const auto& _obj, std::string& _out,
+              const yyjson_write_flag _flag = 0) {
+  write_streaming<Ps...>(_obj, _flag, &_out);
 }
 
-/// Writes a JSON into an ostream.
+/// Writes the JSON into _buf without allocating. Returns the size of the JSON,
+/// which may be larger than _buf. In that case, the content of _buf is
+/// truncated and the call should be repeated with a buffer of at least the
+/// size returned. The JSON is not null-terminated.
+///
+/// Like write(_obj, _ctx), this uses the StreamingWriter, so NaN and infinity
+/// are written as null, unless YYJSON_WRITE_ALLOW_INF_AND_NAN is passed, and
+/// invalid UTF-8 is copied as is, where write(_obj) would fail.
+template <class... Ps>
+size_t write_to(const auto& _obj, const std::span<char> _buf,
+                const yyjson_write_flag _flag = 0) {
+  auto buffer = OutputBuffer(_buf);
+  write_streaming<Ps...>(_obj, _flag, &buffer);
+  return buffer.finish();
+}
+
+/// Writes a JSON into an ostream. With the Streaming processor, the JSON is
+/// written in small chunks, so it is never held in memory as a whole.
 template <class... Ps>
 std::ostream& write(const auto& _obj, std::ostream& _stream,
                     const yyjson_write_flag _flag = 0) {
-  using T = std::remove_cvref_t<decltype(_obj)>;
-  using ParentType = parsing::Parent<Writer>;
-  auto w = Writer(yyjson_mut_doc_new(NULL));
-  Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
-  const char* json_c_str = yyjson_mut_write(w.doc_, _flag, NULL);
-  _stream << json_c_str;
-  free((void*)json_c_str);
-  yyjson_mut_doc_free(w.doc_);
-  return _stream;
+  if constexpr (is_streaming_v<Ps...>) {
+    auto buffer = OutputBuffer(&_stream);
+    write_streaming<Ps...>(_obj, _flag, &buffer);
+    buffer.finish();
+    return _stream;
+  } else {
+    using T = std::remove_cvref_t<decltype(_obj)>;
+    using ParentType = parsing::Parent<Writer>;
+    auto w = Writer(yyjson_mut_doc_new(NULL));
+    Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
+    const char* json_c_str = yyjson_mut_write(w.doc_, _flag, NULL);
+    _stream << json_c_str;
+    free((void*)json_c_str);
+    yyjson_mut_doc_free(w.doc_);
+    return _stream;
+  }
 }
 
 }  // namespace json
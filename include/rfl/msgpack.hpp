@@ -2,8 +2,11 @@
 #define RFL_MSGPACK_HPP_
 
 #include "../rfl.hpp"
+#include "msgpack/OnDemand.hpp"
+#include "msgpack/OnDemandReader.hpp"
 #include "msgpack/Parser.hpp"
 #include "msgpack/Reader.hpp"
+#include "msgpack/StreamReader.hpp"
 #include "msgpack/Writer.hpp"
 #include "msgpack/load.hpp"
 #include "msgpack/read.hpp"
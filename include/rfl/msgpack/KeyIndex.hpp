@@ -0,0 +1,121 @@
+#ifndef RFL_MSGPACK_KEYINDEX_HPP_
+#define RFL_MSGPACK_KEYINDEX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace rfl {
+namespace msgpack {
+
+/// Maps the string keys of a msgpack map to the position and the value of
+/// their first occurrence. msgpack maps are unsorted, so without an index,
+/// every lookup by name is a linear scan over the keys. The readers build the
+/// index on the first lookup and keep it in the InputObjectType, so any
+/// further lookups in the same map, such as untagged variants checking each
+/// alternative for its required fields, take constant time. Uses open
+/// addressing with linear probing and a load factor of at most 0.5.
+///
+/// The index also records where a linear scan would have stopped, so the
+/// readers can report the same errors as before.
+template <class ValueType>
+class KeyIndex {
+ public:
+  struct Entry {
+    std::string_view key_;
+    std::uint32_t pos_;
+    ValueType val_;
+  };
+
+  /// Smaller maps are scanned linearly, which is faster than building an
+  /// index for them.
+  static constexpr std::uint32_t min_map_size_ = 16;
+
+  /// The map has _size keys.
+  explicit KeyIndex(const std::uint32_t _size)
+      : slots_(num_slots(_size), empty_),
+        first_non_string_(_size),
+        first_malformed_(_size) {
+    entries_.reserve(_size);
+  }
+
+  /// Adds the string key at position _pos, unless it has been added before.
+  void add(const std::string_view _key, const std::uint32_t _pos,
+           const ValueType& _val) {
+    const auto mask = slots_.size() - 1;
+    auto ix = std::hash<std::string_view>()(_key) & mask;
+    while (slots_[ix] != empty_) {
+      if (entries_[slots_[ix]].key_ == _key) {
+        return;
+      }
+      ix = (ix + 1) & mask;
+    }
+    slots_[ix] = static_cast<std::uint32_t>(entries_.size());
+    entries_.push_back(Entry{_key, _pos, _val});
+  }
+
+  /// Records that the key at position _pos is not a string.
+  void add_non_string(const std::uint32_t _pos) noexcept {
+    first_non_string_ = std::min(first_non_string_, _pos);
+  }
+
+  /// Records that the input is malformed at position _pos, after which no
+  /// more keys can be added.
+  void add_malformed(const std::uint32_t _pos) noexcept {
+    first_malformed_ = std::min(first_malformed_, _pos);
+  }
+
+  /// Returns the first occurrence of _key or nullptr, if there is none.
+  const Entry* find(const std::string_view _key) const noexcept {
+    const auto mask = slots_.size() - 1;
+    auto ix = std::hash<std::string_view>()(_key) & mask;
+    while (slots_[ix] != empty_) {
+      const auto& entry = entries_[slots_[ix]];
+      if (entry.key_ == _key) {
+        return &entry;
+      }
+      ix = (ix + 1) & mask;
+    }
+    return nullptr;
+  }
+
+  /// The position of the first key that is not a string or the size of the
+  /// map, if all of them are strings.
+  std::uint32_t first_non_string() const noexcept { return first_non_string_; }
+
+  /// The position of the first key whose value is malformed or the size of
+  /// the map, if there is none.
+  std::uint32_t first_malformed() const noexcept { return first_malformed_; }
+
+ private:
+  static constexpr std::uint32_t empty_ = 0xffffffff;
+
+  static size_t num_slots(const std::uint32_t _size) noexcept {
+    size_t n = 2;
+    while (n < 2 * static_cast<size_t>(_size)) {
+      n *= 2;
+    }
+    return n;
+  }
+
+ private:
+  /// The positions of the entries in entries_ or empty_.
+  std::vector<std::uint32_t> slots_;
+
+  /// The first occurrence of every string key, in the order of the map.
+  std::vector<Entry> entries_;
+
+  /// See first_non_string().
+  std::uint32_t first_non_string_;
+
+  /// See first_malformed().
+  std::uint32_t first_malformed_;
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef RFL_MSGPACK_ONDEMAND_HPP_
+#define RFL_MSGPACK_ONDEMAND_HPP_
+
+#include <type_traits>
+
+namespace rfl::msgpack {
+
+/// This is a "fake" processor - it doesn't do anything to the fields, but
+/// passing it to msgpack::read(...) or msgpack::load(...) selects the
+/// OnDemandReader, which reads the object directly from the bytes instead of
+/// unpacking them into a tree of msgpack_object first:
+///
+///   rfl::msgpack::read<Person, rfl::msgpack::OnDemand>(bytes);
+///
+/// Types with a custom constructor (from_msgpack_obj) are not supported.
+struct OnDemand {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+template <class... Ps>
+constexpr bool is_on_demand_v =
+    std::disjunction_v<std::is_same<std::remove_cvref_t<Ps>, OnDemand>...>;
+
+}  // namespace rfl::msgpack
+
+#endif
@@ -0,0 +1,656 @@
+#ifndef RFL_MSGPACK_ONDEMANDREADER_HPP_
+#define RFL_MSGPACK_ONDEMANDREADER_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../Bytestring.hpp"
+#include "../Result.hpp"
+#include "../always_false.hpp"
+#include "../internal/ptr_cast.hpp"
+#include "../parsing/NodeKind.hpp"
+#include "KeyIndex.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+/// An alternative to msgpack::Reader, which decodes directly from the bytes
+/// instead of having msgpack_unpack(...) build a tree of msgpack_object
+/// first. Every value is represented by a cursor pointing to its header, which
+/// is only decoded when the value is actually read. Values that are not
+/// needed are skipped by their length, strings and binaries are exposed as
+/// views into the input. The error messages are the same as
+/// msgpack::Reader's.
+///
+/// Whenever a value has been read completely, its end is written to the slot
+/// the value carries, so read_array(...) and read_object(...) only need to
+/// skip the values nobody has read and every byte is walked only once.
+struct OnDemandReader {
+  /// Maps the keys to the headers of their values.
+  using IndexType = KeyIndex<const char*>;
+
+  struct OnDemandInputArray {
+    OnDemandInputArray(const char* _ptr, const std::uint32_t _size,
+                       const char** _end = nullptr)
+        : ptr_(_ptr), size_(_size), end_(_end) {}
+    /// The header of the first element.
+    const char* ptr_;
+    std::uint32_t size_;
+    /// Receives the end of the array, once all elements have been read.
+    const char** end_;
+  };
+
+  struct OnDemandInputObject {
+    OnDemandInputObject(const char* _ptr, const std::uint32_t _size,
+                        const char** _end = nullptr)
+        : ptr_(_ptr), size_(_size), end_(_end) {}
+    /// The header of the first key.
+    const char* ptr_;
+    std::uint32_t size_;
+    /// Receives the end of the map, once all fields have been read.
+    const char** end_;
+    /// Built on the first lookup by name, see index_for(...).
+    mutable std::shared_ptr<const IndexType> index_;
+  };
+
+  struct OnDemandInputVar {
+    OnDemandInputVar() : ptr_(nullptr), end_(nullptr) {}
+    OnDemandInputVar(const char* _ptr, const char** _end = nullptr)
+        : ptr_(_ptr), end_(_end) {}
+    /// The header of the value or nullptr, if the value is absent.
+    const char* ptr_;
+    /// Receives the end of the value, once it has been read completely, or
+    /// nullptr, if nobody needs to know.
+    const char** end_;
+  };
+
+  using InputArrayType = OnDemandInputArray;
+  using InputObjectType = OnDemandInputObject;
+  using InputVarType = OnDemandInputVar;
+
+  enum class Kind : std::uint8_t {
+    nil,
+    boolean,
+    positive_integer,
+    negative_integer,
+    float32,
+    float64,
+    str,
+    bin,
+    ext,
+    array,
+    map,
+    invalid
+  };
+
+  /// A decoded header.
+  struct Header {
+    Kind kind_;
+
+    /// The payload of strings, binaries and extensions or the first element
+    /// of arrays and maps.
+    const char* data_;
+
+    /// The length of strings, binaries and extensions, the number of
+    /// elements of arrays and maps or the bits of booleans and numbers.
+    std::uint64_t value_;
+
+    /// The header of whatever follows. For arrays and maps, this is the
+    /// first element, for everything else, the next value.
+    const char* next_;
+  };
+
+  /// Time stamps are read from extension type -1.
+  static constexpr bool supports_timestamps = true;
+
+  template <class T>
+  static constexpr bool has_custom_constructor =
+      (requires(InputVarType var) { T::from_msgpack_obj(var); });
+
+  /// The input ends at _end.
+  OnDemandReader(const char* _end) : end_(_end) {}
+
+  rfl::Result<InputVarType> get_field_from_array(
+      const size_t _idx, const InputArrayType _arr) const noexcept {
+    if (_idx >= _arr.size_) {
+      return error("Index " + std::to_string(_idx) + " of of bounds.");
+    }
+    const char* ptr = _arr.ptr_;
+    for (size_t i = 0; ptr && i < _idx; ++i) {
+      ptr = skip(ptr);
+    }
+    if (!ptr) {
+      return error(malformed());
+    }
+    return InputVarType(ptr);
+  }
+
+  rfl::Result<InputVarType> get_field_from_object(
+      const std::string& _name, const InputObjectType& _obj) const noexcept {
+    if (_obj.size_ >= IndexType::min_map_size_) {
+      const auto& index = index_for(_obj);
+      const auto entry = index.find(_name);
+      if (entry && entry->pos_ < index.first_non_string()) {
+        return InputVarType(entry->val_);
+      }
+      // This is where the linear scan below would have stopped.
+      if (index.first_non_string() < _obj.size_ &&
+          index.first_non_string() <= index.first_malformed()) {
+        return error("Key in element " +
+                     std::to_string(index.first_non_string()) +
+                     " was not a string.");
+      }
+      if (index.first_malformed() < _obj.size_) {
+        return error(malformed());
+      }
+      return error("No field named '" + _name + "' was found.");
+    }
+    const char* ptr = _obj.ptr_;
+    for (std::uint32_t i = 0; i < _obj.size_; ++i) {
+      const auto key = header(ptr);
+      if (key.kind_ != Kind::str) {
+        return error("Key in element " + std::to_string(i) +
+                     " was not a string.");
+      }
+      if (_name == std::string_view(key.data_, key.value_)) {
+        return InputVarType(key.next_);
+      }
+      ptr = skip(key.next_);
+      if (!ptr) {
+        return error(malformed());
+      }
+    }
+    return error("No field named '" + _name + "' was found.");
+  }
+
+  bool has_field(const std::string_view _name,
+                 const InputObjectType& _obj) const noexcept {
+    if (_obj.size_ >= IndexType::min_map_size_) {
+      return index_for(_obj).find(_name) != nullptr;
+    }
+    const char* ptr = _obj.ptr_;
+    for (std::uint32_t i = 0; ptr && i < _obj.size_; ++i) {
+      const auto key = header(ptr);
+      if (key.kind_ == Kind::str &&
+          _name == std::string_view(key.data_, key.value_)) {
+        return true;
+      }
+      ptr = key.kind_ == Kind::invalid ? nullptr : skip(key.next_);
+    }
+    return false;
+  }
+
+  bool is_empty(const InputVarType& _var) const noexcept {
+    return !_var.ptr_ || header(_var.ptr_).kind_ == Kind::nil;
+  }
+
+  parsing::NodeKind node_kind(const InputVarType& _var) const noexcept {
+    switch (kind(_var)) {
+      case Kind::nil:
+        return parsing::NodeKind::null;
+      case Kind::boolean:
+        return parsing::NodeKind::boolean;
+      case Kind::positive_integer:
+      case Kind::negative_integer:
+      case Kind::float32:
+      case Kind::float64:
+        return parsing::NodeKind::number;
+      case Kind::str:
+        return parsing::NodeKind::string;
+      case Kind::array:
+        return parsing::NodeKind::array;
+      case Kind::map:
+        return parsing::NodeKind::object;
+      default:
+        return parsing::NodeKind::unknown;
+    }
+  }
+
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    const auto h = header(_var.ptr_);
+    if (h.kind_ != Kind::str) {
+      return error("Could not cast to string.");
+    }
+    record(_var.end_, h.next_);
+    return std::string_view(h.data_, h.value_);
+  }
+
+  rfl::Result<std::span<const std::byte>> to_bytes_view(
+      const InputVarType& _var) const noexcept {
+    const auto h = header(_var.ptr_);
+    if (h.kind_ != Kind::bin) {
+      return error("Could not cast to a bytestring.");
+    }
+    record(_var.end_, h.next_);
+    return std::span<const std::byte>(
+        internal::ptr_cast<const std::byte*>(h.data_), h.value_);
+  }
+
+  template <class T>
+  rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
+    const auto h = header(_var.ptr_);
+    auto res = decode<T>(h);
+    if (res) {
+      record(_var.end_, h.next_);
+    }
+    return res;
+  }
+
+  rfl::Result<InputArrayType> to_array(
+      const InputVarType& _var) const noexcept {
+    const auto h = header(_var.ptr_);
+    if (h.kind_ != Kind::array) {
+      return error("Could not cast to an array.");
+    }
+    return InputArrayType(h.data_, static_cast<std::uint32_t>(h.value_),
+                          _var.end_);
+  }
+
+  rfl::Result<InputObjectType> to_object(
+      const InputVarType& _var) const noexcept {
+    const auto h = header(_var.ptr_);
+    if (h.kind_ != Kind::map) {
+      return error("Could not cast to a map.");
+    }
+    return InputObjectType(h.data_, static_cast<std::uint32_t>(h.value_),
+                           _var.end_);
+  }
+
+  /// Every element takes at least one byte, so sizes the rest of the input
+  /// cannot hold are capped before anybody reserves memory for them.
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return std::min(static_cast<size_t>(_arr.size_), remaining(_arr.ptr_));
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return std::min(static_cast<size_t>(_obj.size_), remaining(_obj.ptr_) / 2);
+  }
+
+  template <class ArrayReader>
+  std::optional<Error> read_array(const ArrayReader& _array_reader,
+                                  const InputArrayType& _arr) const noexcept {
+    const char* ptr = _arr.ptr_;
+    for (std::uint32_t i = 0; i < _arr.size_; ++i) {
+      const char* next = nullptr;
+      const auto err = _array_reader.read(InputVarType(ptr, &next));
+      if (err) {
+        return err;
+      }
+      if (!next) {
+        next = skip(ptr);
+        if (!next) {
+          return rfl::Error(malformed());
+        }
+      }
+      ptr = next;
+    }
+    record(_arr.end_, ptr);
+    return std::nullopt;
+  }
+
+  template <class ObjectReader>
+  std::optional<Error> read_object(const ObjectReader& _object_reader,
+                                   const InputObjectType& _obj) const noexcept {
+    const char* ptr = _obj.ptr_;
+    for (std::uint32_t i = 0; i < _obj.size_; ++i) {
+      const auto key = header(ptr);
+      if (key.kind_ != Kind::str) {
+        return rfl::Error("Key in element " + std::to_string(i) +
+                          " was not a string.");
+      }
+      const auto name = std::string_view(key.data_, key.value_);
+      const char* next = nullptr;
+      _object_reader.read(name, InputVarType(key.next_, &next));
+      if (!next) {
+        next = skip(key.next_);
+        if (!next) {
+          return rfl::Error(malformed());
+        }
+      }
+      ptr = next;
+    }
+    record(_obj.end_, ptr);
+    return std::nullopt;
+  }
+
+  template <class T>
+  rfl::Result<T> use_custom_constructor(
+      const InputVarType& _var) const noexcept {
+    try {
+      return T::from_msgpack_obj(_var);
+    } catch (std::exception& e) {
+      return error(e.what());
+    }
+  }
+
+  /// Returns the position following the value starting at _ptr or nullptr,
+  /// if the value is truncated or malformed. Nested values are skipped by
+  /// counting how many are still outstanding rather than by recursion, so
+  /// deeply nested input cannot overflow the stack.
+  const char* skip(const char* _ptr) const noexcept {
+    std::uint64_t remaining = 1;
+    while (remaining > 0) {
+      const auto h = header(_ptr);
+      if (h.kind_ == Kind::invalid) {
+        return nullptr;
+      }
+      --remaining;
+      if (h.kind_ == Kind::array) {
+        remaining += h.value_;
+      } else if (h.kind_ == Kind::map) {
+        remaining += 2 * h.value_;
+      }
+      _ptr = h.next_;
+    }
+    return _ptr;
+  }
+
+  /// Decodes the header at _ptr. Anything that does not fit into the input
+  /// is Kind::invalid.
+  Header header(const char* _ptr) const noexcept {
+    constexpr auto invalid = Header{Kind::invalid, nullptr, 0, nullptr};
+
+    if (!_ptr || _ptr >= end_) {
+      return invalid;
+    }
+
+    const auto b = static_cast<std::uint8_t>(*_ptr);
+    const char* p = _ptr + 1;
+
+    // Reads an unsigned integer of _n bytes following the first byte.
+    const auto load = [&](const size_t _n, std::uint64_t* _val) -> bool {
+      if (static_cast<size_t>(end_ - p) < _n) {
+        return false;
+      }
+      std::uint64_t val = 0;
+      for (size_t i = 0; i < _n; ++i) {
+        val = (val << 8) | static_cast<std::uint8_t>(p[i]);
+      }
+      p += _n;
+      *_val = val;
+      return true;
+    };
+
+    // A fixed-size scalar with _n bytes of payload.
+    const auto scalar = [&](const Kind _kind, const size_t _n) -> Header {
+      std::uint64_t val = 0;
+      if (!load(_n, &val)) {
+        return invalid;
+      }
+      return Header{_kind, nullptr, val, p};
+    };
+
+    // A signed integer with _n bytes of payload.
+    const auto signed_int = [&](const size_t _n) -> Header {
+      std::uint64_t val = 0;
+      if (!load(_n, &val)) {
+        return invalid;
+      }
+      const auto shift = 64 - 8 * _n;
+      const auto i = static_cast<std::int64_t>(val << shift) >> shift;
+      return Header{i < 0 ? Kind::negative_integer : Kind::positive_integer,
+                    nullptr, static_cast<std::uint64_t>(i), p};
+    };
+
+    // A string, binary or extension, whose length takes _n bytes.
+    const auto blob = [&](const Kind _kind, const size_t _n,
+                          const bool _has_type) -> Header {
+      std::uint64_t len = 0;
+      if (!load(_n, &len)) {
+        return invalid;
+      }
+      // Extensions have a type byte in front of the payload.
+      const char* data = _has_type ? p + 1 : p;
+      if (data > end_ || static_cast<std::uint64_t>(end_ - data) < len) {
+        return invalid;
+      }
+      return Header{_kind, data, len, data + len};
+    };
+
+    // An array or map, whose size takes _n bytes.
+    const auto container = [&](const Kind _kind, const size_t _n) -> Header {
+      std::uint64_t size = 0;
+      if (!load(_n, &size)) {
+        return invalid;
+      }
+      return Header{_kind, p, size, p};
+    };
+
+    if (b <= 0x7f) {
+      return Header{Kind::positive_integer, nullptr, b, p};
+    } else if (b <= 0x8f) {
+      return Header{Kind::map, p, static_cast<std::uint64_t>(b & 0x0f), p};
+    } else if (b <= 0x9f) {
+      return Header{Kind::array, p, static_cast<std::uint64_t>(b & 0x0f), p};
+    } else if (b <= 0xbf) {
+      const std::uint64_t len = b & 0x1f;
+      if (static_cast<std::uint64_t>(end_ - p) < len) {
+        return invalid;
+      }
+      return Header{Kind::str, p, len, p + len};
+    } else if (b >= 0xe0) {
+      return Header{Kind::negative_integer, nullptr,
+                    static_cast<std::uint64_t>(static_cast<std::int8_t>(b)),
+                    p};
+    }
+
+    switch (b) {
+      case 0xc0:
+        return Header{Kind::nil, nullptr, 0, p};
+      case 0xc2:
+        return Header{Kind::boolean, nullptr, 0, p};
+      case 0xc3:
+        return Header{Kind::boolean, nullptr, 1, p};
+      case 0xc4:
+        return blob(Kind::bin, 1, false);
+      case 0xc5:
+        return blob(Kind::bin, 2, false);
+      case 0xc6:
+        return blob(Kind::bin, 4, false);
+      case 0xc7:
+        return blob(Kind::ext, 1, true);
+      case 0xc8:
+        return blob(Kind::ext, 2, true);
+      case 0xc9:
+        return blob(Kind::ext, 4, true);
+      case 0xca:
+        return scalar(Kind::float32, 4);
+      case 0xcb:
+        return scalar(Kind::float64, 8);
+      case 0xcc:
+        return scalar(Kind::positive_integer, 1);
+      case 0xcd:
+        return scalar(Kind::positive_integer, 2);
+      case 0xce:
+        return scalar(Kind::positive_integer, 4);
+      case 0xcf:
+        return scalar(Kind::positive_integer, 8);
+      case 0xd0:
+        return signed_int(1);
+      case 0xd1:
+        return signed_int(2);
+      case 0xd2:
+        return signed_int(4);
+      case 0xd3:
+        return signed_int(8);
+      case 0xd4:
+      case 0xd5:
+      case 0xd6:
+      case 0xd7:
+      case 0xd8: {
+        const std::uint64_t len = std::uint64_t(1) << (b - 0xd4);
+        if (static_cast<std::uint64_t>(end_ - p) < len + 1) {
+          return invalid;
+        }
+        return Header{Kind::ext, p + 1, len, p + 1 + len};
+      }
+      case 0xd9:
+        return blob(Kind::str, 1, false);
+      case 0xda:
+        return blob(Kind::str, 2, false);
+      case 0xdb:
+        return blob(Kind::str, 4, false);
+      case 0xdc:
+        return container(Kind::array, 2);
+      case 0xdd:
+        return container(Kind::array, 4);
+      case 0xde:
+        return container(Kind::map, 2);
+      case 0xdf:
+        return container(Kind::map, 4);
+      default:
+        return invalid;
+    }
+  }
+
+ private:
+  /// Decodes the basic type T from the value with the header _h.
+  template <class T>
+  rfl::Result<T> decode(const Header& _h) const noexcept {
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
+      if (_h.kind_ != Kind::str) {
+        return error("Could not cast to string.");
+      }
+      return std::string(_h.data_, _h.value_);
+
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      rfl::Bytestring>()) {
+      if (_h.kind_ != Kind::bin) {
+        return error("Could not cast to a bytestring.");
+      }
+      const auto data = internal::ptr_cast<const std::byte*>(_h.data_);
+      return rfl::Bytestring(data, data + _h.value_);
+
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
+      if (_h.kind_ != Kind::boolean) {
+        return error("Could not cast to boolean.");
+      }
+      return _h.value_ != 0;
+
+    } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
+      if (_h.kind_ == Kind::float32) {
+        return static_cast<T>(
+            std::bit_cast<float>(static_cast<std::uint32_t>(_h.value_)));
+      } else if (_h.kind_ == Kind::float64) {
+        return static_cast<T>(std::bit_cast<double>(_h.value_));
+      }
+      return error(
+          "Could not cast to numeric value. The type must be float "
+          "or double.");
+
+    } else if constexpr (std::is_integral<std::remove_cvref_t<T>>()) {
+      if (_h.kind_ == Kind::positive_integer) {
+        return static_cast<T>(_h.value_);
+      } else if (_h.kind_ == Kind::negative_integer) {
+        return static_cast<T>(static_cast<std::int64_t>(_h.value_));
+      }
+      return error(
+          "Could not cast to numeric value. The type must be integral, float "
+          "or double.");
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      const auto secs = to_timestamp(_h);
+      if (!secs) {
+        return error("Could not cast to timestamp.");
+      }
+      return std::chrono::sys_seconds(std::chrono::seconds(*secs));
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+  }
+
+  /// Writes _ptr to _slot, if there is one.
+  static void record(const char** _slot, const char* _ptr) noexcept {
+    if (_slot) {
+      *_slot = _ptr;
+    }
+  }
+
+  /// The number of bytes between _ptr and the end of the input.
+  size_t remaining(const char* _ptr) const noexcept {
+    return _ptr && _ptr < end_ ? static_cast<size_t>(end_ - _ptr) : 0;
+  }
+
+  Kind kind(const InputVarType& _var) const noexcept {
+    return _var.ptr_ ? header(_var.ptr_).kind_ : Kind::nil;
+  }
+
+  /// Decodes the seconds of a time stamp, which is extension type -1 with a
+  /// payload of 4, 8 or 12 bytes. The nanoseconds are dropped.
+  static std::optional<std::int64_t> to_timestamp(const Header& _h) noexcept {
+    if (_h.kind_ != Kind::ext || static_cast<std::int8_t>(_h.data_[-1]) != -1) {
+      return std::nullopt;
+    }
+    const auto load = [&](const size_t _offset, const size_t _n) {
+      std::uint64_t val = 0;
+      for (size_t i = 0; i < _n; ++i) {
+        val = (val << 8) | static_cast<std::uint8_t>(_h.data_[_offset + i]);
+      }
+      return val;
+    };
+    switch (_h.value_) {
+      case 4:
+        return static_cast<std::int64_t>(load(0, 4));
+      case 8:
+        return static_cast<std::int64_t>(load(0, 8) & 0x3ffffffffULL);
+      case 12:
+        return static_cast<std::int64_t>(load(4, 8));
+      default:
+        return std::nullopt;
+    }
+  }
+
+  /// Returns the index of the keys in _obj, which is built on the first call.
+  /// Like the linear scans, it stops at the first key or value that cannot
+  /// be decoded.
+  const IndexType& index_for(const InputObjectType& _obj) const {
+    if (!_obj.index_) {
+      auto index = std::make_shared<IndexType>(_obj.size_);
+      const char* ptr = _obj.ptr_;
+      for (std::uint32_t i = 0; i < _obj.size_; ++i) {
+        const auto key = header(ptr);
+        if (key.kind_ == Kind::invalid) {
+          index->add_non_string(i);
+          index->add_malformed(i);
+          break;
+        }
+        if (key.kind_ == Kind::str) {
+          index->add(std::string_view(key.data_, key.value_), i, key.next_);
+        } else {
+          index->add_non_string(i);
+        }
+        ptr = skip(key.next_);
+        if (!ptr) {
+          index->add_malformed(i);
+          break;
+        }
+      }
+      _obj.index_ = std::move(index);
+    }
+    return *_obj.index_;
+  }
+
+  static std::string malformed() {
+    return "Could not parse msgpack: The input is truncated or malformed.";
+  }
+
+ private:
+  /// The end of the input.
+  const char* end_;
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
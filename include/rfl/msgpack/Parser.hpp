@@ -1,44 +1,55 @@
 #ifndef RFL_MSGPACK_PARSER_HPP_
 #define RFL_MSGPACK_PARSER_HPP_
 
+#include <type_traits>
+
 #include "../parsing/Parser.hpp"
+#include "OnDemandReader.hpp"
 #include "Reader.hpp"
 #include "Writer.hpp"
 
 namespace rfl {
+namespace msgpack {
+
+/// Both readers must accept exactly the same documents.
+template <class R>
+concept IsReader =
+    std::is_same_v<R, Reader> || std::is_same_v<R, OnDemandReader>;
+
+}  // namespace msgpack
+
 namespace parsing {
 
 /// msgpack-c requires us to explicitly set the number of fields in advance.
 /// Because of that, we require all of the fields and then set them to nullptr,
 /// if necessary.
-template <class ProcessorsType, class... FieldTypes>
-requires AreReaderAndWriter<msgpack::Reader, msgpack::Writer,
-                            NamedTuple<FieldTypes...>>
-struct Parser<msgpack::Reader, msgpack::Writer, NamedTuple<FieldTypes...>,
-              ProcessorsType>
+template <class R, class ProcessorsType, class... FieldTypes>
+requires msgpack::IsReader<R> &&
+         AreReaderAndWriter<R, msgpack::Writer, NamedTuple<FieldTypes...>>
+struct Parser<R, msgpack::Writer, NamedTuple<FieldTypes...>, ProcessorsType>
     : public NamedTupleParser<
-          msgpack::Reader, msgpack::Writer,
+          R, msgpack::Writer,
           /*_ignore_empty_containers=*/false,
           /*_all_required=*/true,
           /*_no_field_names=*/ProcessorsType::no_field_names_, ProcessorsType,
           FieldTypes...> {
 };
 
-template <class ProcessorsType, class... Ts>
-requires AreReaderAndWriter<msgpack::Reader, msgpack::Writer, rfl::Tuple<Ts...>>
-struct Parser<msgpack::Reader, msgpack::Writer, rfl::Tuple<Ts...>,
-              ProcessorsType>
-    : public TupleParser<msgpack::Reader, msgpack::Writer,
+template <class R, class ProcessorsType, class... Ts>
+requires msgpack::IsReader<R> &&
+         AreReaderAndWriter<R, msgpack::Writer, rfl::Tuple<Ts...>>
+struct Parser<R, msgpack::Writer, rfl::Tuple<Ts...>, ProcessorsType>
+    : public TupleParser<R, msgpack::Writer,
                          /*_ignore_empty_containers=*/false,
                          /*_all_required=*/true, ProcessorsType,
                          rfl::Tuple<Ts...>> {
 };
 
-template <class ProcessorsType, class... Ts>
-requires AreReaderAndWriter<msgpack::Reader, msgpack::Writer, std::tuple<Ts...>>
-struct Parser<msgpack::Reader, msgpack::Writer, std::tuple<Ts...>,
-              ProcessorsType>
-    : public TupleParser<msgpack::Reader, msgpack::Writer,
+template <class R, class ProcessorsType, class... Ts>
+requires msgpack::IsReader<R> &&
+         AreReaderAndWriter<R, msgpack::Writer, std::tuple<Ts...>>
+struct Parser<R, msgpack::Writer, std::tuple<Ts...>, ProcessorsType>
+    : public TupleParser<R, msgpack::Writer,
                          /*_ignore_empty_containers=*/false,
                          /*_all_required=*/true, ProcessorsType,
                          std::tuple<Ts...>> {
@@ -3,8 +3,11 @@
 
 #include <msgpack.h>
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -13,15 +16,28 @@
 #include "../Result.hpp"
 #include "../always_false.hpp"
 #include "../internal/ptr_cast.hpp"
+#include "../parsing/NodeKind.hpp"
+#include "KeyIndex.hpp"
 
 namespace rfl {
 namespace msgpack {
 
 struct Reader {
+  using IndexType = KeyIndex<const msgpack_object*>;
+
+  struct MsgpackInputObject {
+    msgpack_object_map val_;
+    /// Built on the first lookup by name, see index_for(...).
+    mutable std::shared_ptr<const IndexType> index_;
+  };
+
   using InputArrayType = msgpack_object_array;
-  using InputObjectType = msgpack_object_map;
+  using InputObjectType = MsgpackInputObject;
   using InputVarType = msgpack_object;
 
+  /// Time stamps are read from extension type -1.
+  static constexpr bool supports_timestamps = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_msgpack_obj(var); });
@@ -36,8 +52,22 @@ struct Reader {
 
   rfl::Result<InputVarType> get_field_from_object(
       const std::string& _name, const InputObjectType& _obj) const noexcept {
-    for (uint32_t i = 0; i < _obj.size; ++i) {
-      const auto& key = _obj.ptr[i].key;
+    const auto& map = _obj.val_;
+    if (map.size >= IndexType::min_map_size_) {
+      const auto& index = index_for(_obj);
+      const auto entry = index.find(_name);
+      if (entry && entry->pos_ < index.first_non_string()) {
+        return *entry->val_;
+      }
+      if (index.first_non_string() < map.size) {
+        return error("Key in element " +
+                     std::to_string(index.first_non_string()) +
+                     " was not a string.");
+      }
+      return error("No field named '" + _name + "' was found.");
+    }
+    for (uint32_t i = 0; i < map.size; ++i) {
+      const auto& key = map.ptr[i].key;
       if (key.type != MSGPACK_OBJECT_STR) {
         return error("Key in element " + std::to_string(i) +
                      " was not a string.");
@@ -45,16 +75,72 @@ struct Reader {
       const auto current_name =
           std::string_view(key.via.str.ptr, key.via.str.size);
       if (_name == current_name) {
-        return _obj.ptr[i].val;
+        return map.ptr[i].val;
       }
     }
     return error("No field named '" + _name + "' was found.");
   }
 
+  bool has_field(const std::string_view _name,
+                 const InputObjectType& _obj) const noexcept {
+    const auto& map = _obj.val_;
+    if (map.size >= IndexType::min_map_size_) {
+      return index_for(_obj).find(_name) != nullptr;
+    }
+    for (uint32_t i = 0; i < map.size; ++i) {
+      const auto& key = map.ptr[i].key;
+      if (key.type == MSGPACK_OBJECT_STR &&
+          _name == std::string_view(key.via.str.ptr, key.via.str.size)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   bool is_empty(const InputVarType& _var) const noexcept {
     return _var.type == MSGPACK_OBJECT_NIL;
   }
 
+  parsing::NodeKind node_kind(const InputVarType& _var) const noexcept {
+    switch (_var.type) {
+      case MSGPACK_OBJECT_NIL:
+        return parsing::NodeKind::null;
+      case MSGPACK_OBJECT_BOOLEAN:
+        return parsing::NodeKind::boolean;
+      case MSGPACK_OBJECT_POSITIVE_INTEGER:
+      case MSGPACK_OBJECT_NEGATIVE_INTEGER:
+      case MSGPACK_OBJECT_FLOAT32:
+      case MSGPACK_OBJECT_FLOAT64:
+        return parsing::NodeKind::number;
+      case MSGPACK_OBJECT_STR:
+        return parsing::NodeKind::string;
+      case MSGPACK_OBJECT_ARRAY:
+        return parsing::NodeKind::array;
+      case MSGPACK_OBJECT_MAP:
+        return parsing::NodeKind::object;
+      default:
+        return parsing::NodeKind::unknown;
+    }
+  }
+
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    if (_var.type != MSGPACK_OBJECT_STR) {
+      return error("Could not cast to string.");
+    }
+    return std::string_view(_var.via.str.ptr, _var.via.str.size);
+  }
+
+  rfl::Result<std::span<const std::byte>> to_bytes_view(
+      const InputVarType& _var) const noexcept {
+    if (_var.type != MSGPACK_OBJECT_BIN) {
+      return error("Could not cast to a bytestring.");
+    }
+    const auto bin = _var.via.bin;
+    return std::span<const std::byte>(
+        internal::ptr_cast<const std::byte*>(bin.ptr), bin.size);
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     const auto type = _var.type;
@@ -98,6 +184,13 @@ struct Reader {
       return error(
           "Could not cast to numeric value. The type must be integral, float "
           "or double.");
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::chrono::sys_seconds>()) {
+      msgpack_timestamp ts;
+      if (!msgpack_object_to_timestamp(&_var, &ts)) {
+        return error("Could not cast to timestamp.");
+      }
+      return std::chrono::sys_seconds(std::chrono::seconds(ts.tv_sec));
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -116,7 +209,15 @@ struct Reader {
     if (_var.type != MSGPACK_OBJECT_MAP) {
       return error("Could not cast to a map.");
     }
-    return _var.via.map;
+    return InputObjectType{.val_ = _var.via.map, .index_ = nullptr};
+  }
+
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.size;
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.val_.size;
   }
 
   template <class ArrayReader>
@@ -134,9 +235,10 @@ struct Reader {
   template <class ObjectReader>
   std::optional<Error> read_object(const ObjectReader& _object_reader,
                                    const InputObjectType& _obj) const noexcept {
-    for (uint32_t i = 0; i < _obj.size; ++i) {
-      const auto& key = _obj.ptr[i].key;
-      const auto& val = _obj.ptr[i].val;
+    const auto& map = _obj.val_;
+    for (uint32_t i = 0; i < map.size; ++i) {
+      const auto& key = map.ptr[i].key;
+      const auto& val = map.ptr[i].val;
       if (key.type != MSGPACK_OBJECT_STR) {
         return rfl::Error("Key in element " + std::to_string(i) +
                           " was not a string.");
@@ -156,6 +258,26 @@ struct Reader {
       return error(e.what());
     }
   }
+
+ private:
+  /// Returns the index of the keys in _obj, which is built on the first call.
+  const IndexType& index_for(const InputObjectType& _obj) const {
+    if (!_obj.index_) {
+      const auto& map = _obj.val_;
+      auto index = std::make_shared<IndexType>(map.size);
+      for (uint32_t i = 0; i < map.size; ++i) {
+        const auto& key = map.ptr[i].key;
+        if (key.type != MSGPACK_OBJECT_STR) {
+          index->add_non_string(i);
+          continue;
+        }
+        index->add(std::string_view(key.via.str.ptr, key.via.str.size), i,
+                   &map.ptr[i].val);
+      }
+      _obj.index_ = std::move(index);
+    }
+    return *_obj.index_;
+  }
 };
 
 }  // namespace msgpack
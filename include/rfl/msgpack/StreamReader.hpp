@@ -0,0 +1,146 @@
+#ifndef RFL_MSGPACK_STREAMREADER_HPP_
+#define RFL_MSGPACK_STREAMREADER_HPP_
+
+#include <msgpack.h>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "../Result.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "read.hpp"
+
+namespace rfl::msgpack {
+
+/// Reads a sequence of back-to-back msgpack messages, such as the ones
+/// received over a TCP connection, as the bytes arrive. The bytes can be fed
+/// in chunks of any size and every message is returned as soon as it is
+/// complete:
+///
+///   auto reader = rfl::msgpack::StreamReader<Message>();
+///   while (const auto n = recv(fd, buf, sizeof(buf), 0); n > 0) {
+///     reader.feed(buf, n);
+///     while (const auto res = reader.next()) {
+///       ...
+///     }
+///   }
+///   const auto res = reader.finish();
+///
+/// Unlike msgpack::read(...), the memory pool the messages are unpacked into
+/// is reused for all messages. If a message cannot be parsed into T, the
+/// error is reported with the index of the message and the reader moves on
+/// to the next one. Malformed msgpack cannot be recovered from, so after such
+/// an error, next() returns std::nullopt and feed() fails.
+template <class T, class... Ps>
+class StreamReader {
+  struct UnpackerDeleter {
+    void operator()(msgpack_unpacker* _unpacker) const {
+      msgpack_unpacker_free(_unpacker);
+    }
+  };
+
+ public:
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+
+  explicit StreamReader(
+      const size_t _initial_buffer_size = MSGPACK_UNPACKER_INIT_BUFFER_SIZE)
+      : unpacker_(msgpack_unpacker_new(_initial_buffer_size)) {
+    if (!unpacker_) {
+      error_ = Error("Could not allocate the msgpack unpacker.");
+    }
+  }
+
+  /// Appends the next chunk of the stream.
+  Result<Nothing> feed(const char* _data, const size_t _size) {
+    if (error_) {
+      return error(*error_);
+    }
+    if (_size == 0) {
+      return Nothing{};
+    }
+    if (!msgpack_unpacker_reserve_buffer(unpacker_.get(), _size)) {
+      return error("Could not allocate memory for the msgpack stream.");
+    }
+    std::memcpy(msgpack_unpacker_buffer(unpacker_.get()), _data, _size);
+    msgpack_unpacker_buffer_consumed(unpacker_.get(), _size);
+    incomplete_ = true;
+    return Nothing{};
+  }
+
+  /// Returns the next message or std::nullopt, if no complete message has
+  /// been received yet.
+  std::optional<ResultType> next() {
+    if (error_) {
+      return std::nullopt;
+    }
+
+    const int ret = msgpack_unpacker_execute(unpacker_.get());
+    if (ret == 0) {
+      return std::nullopt;
+    }
+    if (ret < 0) {
+      error_ = unpack_error(static_cast<msgpack_unpack_return>(ret));
+      return ResultType(error("Message " + std::to_string(index_) + ": " +
+                              error_->what()));
+    }
+
+    auto res = read<T, Ps...>(msgpack_unpacker_data(unpacker_.get()));
+
+    // Strings and binaries point into the buffer, which marks the buffer as
+    // referenced. Flushing hands that reference to the zone, so clearing the
+    // zone releases it and the buffer can be compacted and reused, instead of
+    // being reallocated by the next feed(...). If flushing fails, that is
+    // all that happens.
+    msgpack_unpacker_flush_zone(unpacker_.get());
+    msgpack_unpacker_reset_zone(unpacker_.get());
+    msgpack_unpacker_reset(unpacker_.get());
+
+    // The unpacker also consumes the beginning of an incomplete message,
+    // so only the bytes that follow a complete message are counted here.
+    incomplete_ = msgpack_unpacker_nonparsed_size(unpacker_.get()) > 0;
+
+    const auto index = index_++;
+    if (!res) {
+      return ResultType(error("Message " + std::to_string(index) + ": " +
+                              res.error().what()));
+    }
+    return ResultType(std::move(res));
+  }
+
+  /// Signals the end of the stream. Returns an error, if the stream ended in
+  /// the middle of a message or contained malformed msgpack.
+  Result<Nothing> finish() const {
+    if (error_) {
+      return error(*error_);
+    }
+    if (incomplete_) {
+      return error("Message " + std::to_string(index_) +
+                   ": The stream ended in the middle of a message.");
+    }
+    return Nothing{};
+  }
+
+  /// The number of messages that have been read so far.
+  size_t num_messages() const noexcept { return index_; }
+
+ private:
+  /// Holds the bytes that have been fed, but not yet unpacked, and the memory
+  /// pool the current message is unpacked into.
+  std::unique_ptr<msgpack_unpacker, UnpackerDeleter> unpacker_;
+
+  /// Set when the stream cannot be read any further.
+  std::optional<Error> error_;
+
+  /// Whether some bytes of the next message have already been fed.
+  bool incomplete_ = false;
+
+  /// The index of the next message.
+  size_t index_ = 0;
+};
+
+}  // namespace rfl::msgpack
+
+#endif
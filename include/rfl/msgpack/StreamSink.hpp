@@ -0,0 +1,47 @@
+#ifndef RFL_MSGPACK_STREAMSINK_HPP_
+#define RFL_MSGPACK_STREAMSINK_HPP_
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+namespace rfl::msgpack {
+
+/// Collects the output of a msgpack_packer in a small buffer and writes it
+/// to an std::ostream whenever the buffer is full, so the message never has
+/// to be held in memory as a whole. The packer issues many tiny writes, which
+/// is why they are not forwarded to the stream one by one.
+class StreamSink {
+  static constexpr size_t chunk_size_ = 4096;
+
+ public:
+  explicit StreamSink(std::ostream* _stream) : stream_(_stream) {}
+
+  StreamSink(const StreamSink&) = delete;
+
+  StreamSink& operator=(const StreamSink&) = delete;
+
+  /// Can be passed to msgpack_packer_init(...) along with a pointer to the
+  /// sink.
+  static int write(void* _sink, const char* _buf, size_t _len);
+
+  /// Writes whatever is left in the buffer to the stream.
+  void flush();
+
+ private:
+  void append(const char* _buf, const size_t _len);
+
+ private:
+  /// The stream we write to.
+  std::ostream* stream_;
+
+  /// The bytes that have not been written to the stream yet.
+  std::array<char, chunk_size_> buf_;
+
+  /// The number of bytes in buf_.
+  size_t size_ = 0;
+};
+
+}  // namespace rfl::msgpack
+
+#endif
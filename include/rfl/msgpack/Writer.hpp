@@ -3,6 +3,7 @@
 
 #include <msgpack.h>
 
+#include <chrono>
 #include <exception>
 #include <map>
 #include <sstream>
@@ -33,6 +34,9 @@ class Writer {
   using OutputObjectType = MsgpackOutputObject;
   using OutputVarType = MsgpackOutputVar;
 
+  /// Time stamps are written as extension type -1.
+  static constexpr bool supports_timestamps = true;
+
   Writer(msgpack_packer* _pk);
 
   ~Writer();
@@ -94,9 +98,10 @@ class Writer {
   template <class T>
   OutputVarType new_value(const T& _var) const noexcept {
     using Type = std::remove_cvref_t<T>;
-    if constexpr (std::is_same<Type, std::string>()) {
+    if constexpr (std::is_same<Type, std::string>() ||
+                  std::is_same<Type, std::string_view>()) {
       msgpack_pack_str(pk_, _var.size());
-      msgpack_pack_str_body(pk_, _var.c_str(), _var.size());
+      msgpack_pack_str_body(pk_, _var.data(), _var.size());
     } else if constexpr (std::is_same<Type, rfl::Bytestring>()) {
       msgpack_pack_bin(pk_, _var.size());
       msgpack_pack_bin_body(pk_, _var.c_str(), _var.size());
@@ -110,6 +115,11 @@ class Writer {
       msgpack_pack_double(pk_, static_cast<double>(_var));
     } else if constexpr (std::is_integral<Type>()) {
       msgpack_pack_int64(pk_, static_cast<std::int64_t>(_var));
+    } else if constexpr (std::is_same<Type, std::chrono::sys_seconds>()) {
+      const auto ts = msgpack_timestamp{
+          .tv_sec = static_cast<int64_t>(_var.time_since_epoch().count()),
+          .tv_nsec = 0};
+      msgpack_pack_timestamp(pk_, &ts);
     } else {
       static_assert(rfl::always_false_v<T>, "Unsupported type.");
     }
@@ -4,12 +4,20 @@
 #include <msgpack.h>
 
 #include <istream>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
+#include "../internal/AllowBorrowing.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
+#include "OnDemand.hpp"
+#include "OnDemandReader.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
+#include "unpack_error.hpp"
 
 namespace rfl {
 namespace msgpack {
@@ -24,17 +32,46 @@ auto read(const InputVarType& _obj) {
   return Parser<T, Processors<Ps...>>::read(r, _obj);
 }
 
+/// Parses an object from MSGPACK using the OnDemandReader, which reads
+/// directly from _bytes. The bytes are validated while they are read, so
+/// they only need to be skipped separately when T did not read all of them.
+template <class T, class... Ps>
+Result<internal::wrap_in_rfl_array_t<T>> read_on_demand(const char* _bytes,
+                                                        const size_t _size) {
+  const auto r = OnDemandReader(_bytes + _size);
+  const char* end = nullptr;
+  auto res =
+      parsing::Parser<OnDemandReader, Writer, T, Processors<Ps...>>::read(
+          r, OnDemandReader::InputVarType(_bytes, &end));
+  // Like msgpack_unpack(...), malformed input takes precedence over any
+  // error T reports.
+  if ((!res || !end) && !r.skip(_bytes)) {
+    return error(
+        "Could not parse msgpack: The input is truncated or malformed.");
+  }
+  return res;
+}
+
 /// Parses an object from MSGPACK using reflection.
 template <class T, class... Ps>
 Result<internal::wrap_in_rfl_array_t<T>> read(const char* _bytes,
                                               const size_t _size) {
-  msgpack_zone mempool;
-  msgpack_zone_init(&mempool, 2048);
-  msgpack_object deserialized;
-  msgpack_unpack(_bytes, _size, NULL, &mempool, &deserialized);
-  auto r = read<T, Ps...>(deserialized);
-  msgpack_zone_destroy(&mempool);
-  return r;
+  if constexpr (is_on_demand_v<Ps...>) {
+    return read_on_demand<T, Ps...>(_bytes, _size);
+  } else {
+    msgpack_zone mempool;
+    msgpack_zone_init(&mempool, 2048);
+    msgpack_object deserialized;
+    const auto err = unpack_error(
+        msgpack_unpack(_bytes, _size, NULL, &mempool, &deserialized));
+    if (err) {
+      msgpack_zone_destroy(&mempool);
+      return error(*err);
+    }
+    auto r = read<T, Ps...>(deserialized);
+    msgpack_zone_destroy(&mempool);
+    return r;
+  }
 }
 
 /// Parses an object from MSGPACK using reflection.
@@ -51,6 +88,93 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses a MSGPACK var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const InputVarType& _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses MSGPACK into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const char* _bytes,
+                          const size_t _size) {
+  msgpack_zone mempool;
+  msgpack_zone_init(&mempool, 2048);
+  msgpack_object deserialized;
+  const auto err = unpack_error(
+      msgpack_unpack(_bytes, _size, NULL, &mempool, &deserialized));
+  if (err) {
+    msgpack_zone_destroy(&mempool);
+    return error(*err);
+  }
+  auto res = read_into<Ps...>(_target, deserialized);
+  msgpack_zone_destroy(&mempool);
+  return res;
+}
+
+/// Parses MSGPACK into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(_target, _bytes.data(), _bytes.size());
+}
+
+/// Owns the bytes and the memory pool of a document read by read_borrowed.
+class BorrowedDocument {
+ public:
+  BorrowedDocument(std::vector<char>&& _bytes) : bytes_(std::move(_bytes)) {
+    msgpack_zone_init(&mempool_, 2048);
+  }
+
+  BorrowedDocument(const BorrowedDocument&) = delete;
+
+  BorrowedDocument& operator=(const BorrowedDocument&) = delete;
+
+  ~BorrowedDocument() { msgpack_zone_destroy(&mempool_); }
+
+  const std::vector<char>& bytes() const { return bytes_; }
+
+  msgpack_zone* mempool() { return &mempool_; }
+
+ private:
+  std::vector<char> bytes_;
+
+  msgpack_zone mempool_;
+};
+
+/// Parses an object from MSGPACK in borrowing mode: Any std::string_view and
+/// std::span<const std::byte> fields point directly into _bytes instead of
+/// being copied. The bytes are kept alive by the returned rfl::Borrowed.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    std::vector<char> _bytes) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  const auto doc = std::make_shared<BorrowedDocument>(std::move(_bytes));
+  msgpack_object deserialized;
+  const auto err =
+      unpack_error(msgpack_unpack(doc->bytes().data(), doc->bytes().size(),
+                                  NULL, doc->mempool(), &deserialized));
+  if (err) {
+    return error(*err);
+  }
+  const auto to_borrowed = [&](U&& _value) {
+    return Borrowed<U>(std::move(_value), doc);
+  };
+  return read<T, internal::AllowBorrowing, Ps...>(deserialized)
+      .transform(to_borrowed);
+}
+
 }  // namespace msgpack
 }  // namespace rfl
 
@@ -0,0 +1,30 @@
+#ifndef RFL_MSGPACK_UNPACK_ERROR_HPP_
+#define RFL_MSGPACK_UNPACK_ERROR_HPP_
+
+#include <msgpack.h>
+
+#include <optional>
+
+#include "../Result.hpp"
+
+namespace rfl::msgpack {
+
+/// Translates the return value of msgpack_unpack(...) into an error, if it
+/// signals one. Trailing bytes after a complete object are accepted.
+inline std::optional<Error> unpack_error(const msgpack_unpack_return _ret) {
+  switch (_ret) {
+    case MSGPACK_UNPACK_SUCCESS:
+    case MSGPACK_UNPACK_EXTRA_BYTES:
+      return std::nullopt;
+    case MSGPACK_UNPACK_CONTINUE:
+      return Error("Could not parse msgpack: The input is truncated.");
+    case MSGPACK_UNPACK_NOMEM_ERROR:
+      return Error("Could not parse msgpack: Out of memory.");
+    default:
+      return Error("Could not parse msgpack: The input is malformed.");
+  }
+}
+
+}  // namespace rfl::msgpack
+
+#endif
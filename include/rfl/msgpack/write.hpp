@@ -3,39 +3,84 @@
 
 #include <msgpack.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
-#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../Processors.hpp"
 #include "../parsing/Parent.hpp"
 #include "Parser.hpp"
+#include "StreamSink.hpp"
 
 namespace rfl::msgpack {
 
-/// Returns msgpack bytes.
+/// Packs _obj, passing the bytes to _callback along with _data, which is how
+/// msgpack_packer delivers its output.
 template <class... Ps>
-std::vector<char> write(const auto& _obj) noexcept {
+void pack(const auto& _obj, void* _data,
+          const msgpack_packer_write _callback) noexcept {
   using T = std::remove_cvref_t<decltype(_obj)>;
   using ParentType = parsing::Parent<Writer>;
-  msgpack_sbuffer sbuf;
-  msgpack_sbuffer_init(&sbuf);
   msgpack_packer pk;
-  msgpack_packer_init(&pk, &sbuf, msgpack_sbuffer_write);
+  msgpack_packer_init(&pk, _data, _callback);
   auto w = Writer(&pk);
   Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
-  auto bytes = std::vector<char>(sbuf.data, sbuf.data + sbuf.size);
-  msgpack_sbuffer_destroy(&sbuf);
+}
+
+/// A msgpack_packer_write callback, which appends to a std::vector<char> or
+/// std::string.
+template <class ContainerType>
+int append_to_container(void* _container, const char* _buf, size_t _len) {
+  auto container = static_cast<ContainerType*>(_container);
+  container->insert(container->end(), _buf, _buf + _len);
+  return 0;
+}
+
+/// Returns the number of bytes _obj is packed into, without storing them.
+/// This requires a full pass over _obj, but that pass is several times
+/// cheaper than packing, because nothing is copied.
+template <class... Ps>
+size_t packed_size(const auto& _obj) noexcept {
+  size_t size = 0;
+  pack<Ps...>(_obj, &size, [](void* _size, const char*, size_t _len) -> int {
+    *static_cast<size_t*>(_size) += _len;
+    return 0;
+  });
+  return size;
+}
+
+/// Appends msgpack bytes to _out. The bytes are packed directly into _out, so
+/// any capacity _out already has is reused.
+template <class... Ps>
+void write_to(const auto& _obj, std::vector<char>& _out) noexcept {
+  pack<Ps...>(_obj, &_out, append_to_container<std::vector<char>>);
+}
+
+/// Appends msgpack bytes to _out. The bytes are packed directly into _out, so
+/// any capacity _out already has is reused.
+template <class... Ps>
+void write_to(const auto& _obj, std::string& _out) noexcept {
+  pack<Ps...>(_obj, &_out, append_to_container<std::string>);
+}
+
+/// Returns msgpack bytes.
+template <class... Ps>
+std::vector<char> write(const auto& _obj) noexcept {
+  std::vector<char> bytes;
+  write_to<Ps...>(_obj, bytes);
   return bytes;
 }
 
-/// Writes a MSGPACK into an ostream.
+/// Writes a MSGPACK into an ostream. The bytes are written in small chunks,
+/// so the message is never held in memory as a whole.
 template <class... Ps>
 std::ostream& write(const auto& _obj, std::ostream& _stream) noexcept {
-  auto buffer = write<Ps...>(_obj);
-  _stream.write(buffer.data(), buffer.size());
+  auto sink = StreamSink(&_stream);
+  pack<Ps...>(_obj, &sink, StreamSink::write);
+  sink.flush();
   return _stream;
 }
 
@@ -10,6 +10,7 @@
 #include "../Result.hpp"
 #include "../internal/is_array.hpp"
 #include "Parser_base.hpp"
+#include "move_to.hpp"
 
 namespace rfl::parsing {
 
@@ -54,24 +55,6 @@ class ArrayReader {
   }
 
  private:
-  template <class Target, class Source>
-  void move_to(Target* _t, Source* _s) const {
-    if constexpr (std::is_const_v<Target>) {
-      return move_to(const_cast<std::remove_const_t<Target>*>(_t), _s);
-    } else if constexpr (!internal::is_array_v<Source> &&
-                         !std::is_array_v<Target>) {
-      ::new (_t) Target(std::move(*_s));
-    } else if constexpr (internal::is_array_v<Source>) {
-      for (size_t i = 0; i < _s->arr_.size(); ++i) {
-        move_to(&((*_t)[i]), &(_s->arr_[i]));
-      }
-    } else {
-      for (size_t i = 0; i < _s->size(); ++i) {
-        move_to(&((*_t)[i]), &((*_s)[i]));
-      }
-    }
-  }
-
  private:
   /// The underlying array.
   std::array<T, size_>* array_;
@@ -0,0 +1,52 @@
+#ifndef RFL_PARSING_FIELDORDERSTATS_HPP_
+#define RFL_PARSING_FIELDORDERSTATS_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+namespace rfl {
+namespace parsing {
+
+/// Counts how often the declaration-order prediction in the view readers
+/// was correct. Only compiled in when REFLECTCPP_FIELD_ORDER_STATS is
+/// defined, so that the counters cost nothing in normal builds.
+struct FieldOrderStats {
+  /// The number of keys that matched the predicted next field.
+  std::atomic<std::uint64_t> hits_ = 0;
+
+  /// The number of keys that required a full lookup.
+  std::atomic<std::uint64_t> misses_ = 0;
+
+  /// Returns the share of keys that matched the predicted next field.
+  double hit_rate() const {
+    const auto hits = hits_.load(std::memory_order_relaxed);
+    const auto total = hits + misses_.load(std::memory_order_relaxed);
+    return total == 0 ? 0.0
+                      : static_cast<double>(hits) / static_cast<double>(total);
+  }
+
+  /// Sets both counters back to zero.
+  void reset() {
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+  }
+};
+
+/// Returns the process-wide counters.
+inline FieldOrderStats& field_order_stats() {
+  static FieldOrderStats stats;
+  return stats;
+}
+
+/// Records whether the predicted field was the one that was actually read.
+inline void record_field_order_prediction([[maybe_unused]] const bool _hit) {
+#ifdef REFLECTCPP_FIELD_ORDER_STATS
+  auto& stats = field_order_stats();
+  (_hit ? stats.hits_ : stats.misses_).fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
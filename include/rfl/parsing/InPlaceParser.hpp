@@ -0,0 +1,178 @@
+#ifndef RFL_PARSING_INPLACEPARSER_HPP_
+#define RFL_PARSING_INPLACEPARSER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../internal/has_reflection_type_v.hpp"
+#include "../internal/has_reflector.hpp"
+#include "../internal/is_array.hpp"
+#include "../internal/processed_t.hpp"
+#include "../to_view.hpp"
+#include "IsReader.hpp"
+#include "Parser_base.hpp"
+#include "move_to.hpp"
+#include "reserve_capacity.hpp"
+#include "schemaful/IsSchemafulReader.hpp"
+
+namespace rfl::parsing {
+
+template <class T>
+struct is_in_place_vector : std::false_type {};
+
+template <class T>
+struct is_in_place_vector<std::vector<T>>
+    : std::bool_constant<!std::is_same_v<T, bool> &&
+                         !std::is_same_v<T, std::byte>> {};
+
+template <class T>
+struct is_in_place_vector<std::deque<T>> : std::true_type {};
+
+template <class T>
+struct is_std_array : std::false_type {};
+
+template <class T, size_t _size>
+struct is_std_array<std::array<T, _size>> : std::true_type {};
+
+/// Parses _var into an object that already exists, reusing as much of its
+/// storage as possible: Strings are overwritten in place, vectors keep their
+/// elements and capacity and structs are updated field by field. Anything that
+/// cannot be updated in place is parsed as usual and then move-assigned. If an
+/// error occurs, the target is left in a valid, but unspecified state.
+template <class R, class W, class T, class ProcessorsType>
+struct InPlaceParser {
+  using InputVarType = typename R::InputVarType;
+
+  static std::optional<Error> read(const R& _r, const InputVarType& _var,
+                                   T* _target) noexcept {
+    if constexpr (schemaful::IsSchemafulReader<R>) {
+      return read_and_move(_r, _var, _target);
+
+    } else if constexpr (std::is_same_v<T, std::string> &&
+                         SupportsStringView<R>) {
+      const auto str = _r.to_string_view(_var);
+      if (!str) {
+        return str.error();
+      }
+      _target->assign(str->data(), str->size());
+      return std::nullopt;
+
+    } else if constexpr (is_std_optional<T>::value) {
+      using U = typename T::value_type;
+      if (_r.is_empty(_var)) {
+        _target->reset();
+        return std::nullopt;
+      }
+      if (*_target) {
+        return InPlaceParser<R, W, std::remove_cvref_t<U>,
+                             ProcessorsType>::read(_r, _var, &**_target);
+      }
+      return read_and_move(_r, _var, _target);
+
+    } else if constexpr (is_in_place_vector<T>::value) {
+      return read_vector(_r, _var, _target);
+
+    } else if constexpr (is_updatable_struct()) {
+      auto view = ProcessorsType::template process<T>(to_view(*_target));
+      using ViewType = std::remove_cvref_t<decltype(view)>;
+      return Parser<R, W, ViewType, ProcessorsType>::read_view_in_place(
+          _r, _var, &view);
+
+    } else {
+      return read_and_move(_r, _var, _target);
+    }
+  }
+
+ private:
+  template <class U>
+  struct is_std_optional : std::false_type {};
+
+  template <class U>
+  struct is_std_optional<std::optional<U>> : std::true_type {};
+
+  /// Plain structs without custom parsing logic can be updated field by field.
+  /// We fall back to the normal parser for DefaultIfMissing, NoFieldNames and
+  /// rfl::ExtraFields, because they would require us to reconstruct the
+  /// missing parts from scratch anyway.
+  static constexpr bool is_updatable_struct() {
+    if constexpr (std::is_class_v<T> && std::is_aggregate_v<T> &&
+                  !is_std_array<T>::value && !internal::has_read_reflector<T> &&
+                  !internal::has_reflection_type_v<T> &&
+                  !R::template has_custom_constructor<T> &&
+                  !ProcessorsType::default_if_missing_ &&
+                  !ProcessorsType::no_field_names_) {
+      return internal::processed_t<T, ProcessorsType>::pos_extra_fields() ==
+             -1;
+    } else {
+      return false;
+    }
+  }
+
+  /// Overwrites the existing elements, appends any additional elements and
+  /// then removes the surplus ones, so no element is reconstructed
+  /// unnecessarily.
+  static std::optional<Error> read_vector(const R& _r, const InputVarType& _var,
+                                          T* _target) {
+    using U = std::remove_cvref_t<typename T::value_type>;
+
+    struct ElementReader {
+      std::optional<Error> read(const InputVarType& _v) const {
+        if (*i_ < vec_->size()) {
+          const auto err = InPlaceParser<R, W, U, ProcessorsType>::read(
+              *r_, _v, &(*vec_)[*i_]);
+          if (err) {
+            return err;
+          }
+        } else {
+          auto res = Parser<R, W, U, ProcessorsType>::read(*r_, _v);
+          if (!res) {
+            return res.error();
+          }
+          vec_->emplace_back(std::move(*res));
+        }
+        ++(*i_);
+        return std::nullopt;
+      }
+
+      const R* r_;
+      T* vec_;
+      size_t* i_;
+    };
+
+    auto arr = _r.to_array(_var);
+    if (!arr) {
+      return arr.error();
+    }
+    reserve_capacity_for_array(_r, *arr, _target);
+    size_t i = 0;
+    const auto element_reader =
+        ElementReader{.r_ = &_r, .vec_ = _target, .i_ = &i};
+    const auto err = _r.read_array(element_reader, *arr);
+    if (err) {
+      return err;
+    }
+    _target->erase(_target->begin() + i, _target->end());
+    return std::nullopt;
+  }
+
+  static std::optional<Error> read_and_move(const R& _r,
+                                            const InputVarType& _var,
+                                            T* _target) {
+    auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if (!res) {
+      return res.error();
+    }
+    move_to</*_overwrite=*/true>(_target, &(*res));
+    return std::nullopt;
+  }
+};
+
+}  // namespace rfl::parsing
+
+#endif
@@ -5,13 +5,16 @@
 #include <concepts>
 #include <cstdint>
 #include <functional>
+#include <cstddef>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 
 #include "../Result.hpp"
 #include "../internal/is_basic_type.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "NodeKind.hpp"
 #include "SupportsTaggedUnions.hpp"
 #include "schemaful/IsSchemafulReader.hpp"
 
@@ -86,6 +89,89 @@ concept IsReader =
       } -> std::same_as<rfl::Result<internal::wrap_in_rfl_array_t<T>>>;
     };
 
+/// Readers can optionally report the number of elements in an array, which
+/// allows containers to reserve their capacity before they are filled:
+///
+///   size_t array_size(const InputArrayType& _arr) const noexcept;
+template <class R>
+concept SupportsArraySize = requires(R r, typename R::InputArrayType arr) {
+  { r.array_size(arr) } -> std::convertible_to<size_t>;
+};
+
+/// Readers can optionally report the number of key-value pairs in an object,
+/// which allows map-like containers to reserve their capacity before they are
+/// filled:
+///
+///   size_t object_size(const InputObjectType& _obj) const noexcept;
+template <class R>
+concept SupportsObjectSize = requires(R r, typename R::InputObjectType obj) {
+  { r.object_size(obj) } -> std::convertible_to<size_t>;
+};
+
+/// Readers can optionally expose strings as a view into the underlying
+/// document, which allows existing strings to be overwritten without creating
+/// a temporary std::string:
+///
+///   rfl::Result<std::string_view> to_string_view(
+///       const InputVarType& _var) const noexcept;
+template <class R>
+concept SupportsStringView = requires(R r, typename R::InputVarType var) {
+  { r.to_string_view(var) } -> std::same_as<rfl::Result<std::string_view>>;
+};
+
+/// Readers can optionally expose binary data as a view into the underlying
+/// document, which is needed for reading std::span<const std::byte> in
+/// read_borrowed(...):
+///
+///   rfl::Result<std::span<const std::byte>> to_bytes_view(
+///       const InputVarType& _var) const noexcept;
+template <class R>
+concept SupportsBytesView = requires(R r, typename R::InputVarType var) {
+  {
+    r.to_bytes_view(var)
+  } -> std::same_as<rfl::Result<std::span<const std::byte>>>;
+};
+
+/// Readers can optionally classify a variable, which allows untagged variants
+/// to skip alternatives that cannot match:
+///
+///   NodeKind node_kind(const InputVarType& _var) const noexcept;
+template <class R>
+concept SupportsNodeKind = requires(R r, typename R::InputVarType var) {
+  { r.node_kind(var) } -> std::same_as<NodeKind>;
+};
+
+/// Readers can optionally check whether an object contains a field without
+/// retrieving it or generating an error message:
+///
+///   bool has_field(std::string_view _name,
+///                  const InputObjectType& _obj) const noexcept;
+template <class R>
+concept SupportsHasField =
+    requires(R r, std::string_view name, typename R::InputObjectType obj) {
+      { r.has_field(name, obj) } -> std::same_as<bool>;
+    };
+
+/// Readers can optionally declare that they can safely be used from several
+/// threads at the same time, which is usually the case when they read from an
+/// immutable document. This allows rfl::Parallel to decode the elements of
+/// large arrays in parallel:
+///
+///   static constexpr bool supports_parallel_reading = true;
+template <class R>
+concept SupportsParallelReading = SupportsArraySize<R> && requires {
+  requires R::supports_parallel_reading;
+};
+
+/// Readers can optionally declare that read_object(...) does not visit the
+/// keys in the order they were written, which is the case when the underlying
+/// document keeps them in a sorted or hashed container. The view readers then
+/// do not try to predict the next field from the declaration order:
+///
+///   static constexpr bool reorders_keys = true;
+template <class R>
+concept ReordersKeys = requires { requires R::reorders_keys; };
+
 }  // namespace parsing
 }  // namespace rfl
 
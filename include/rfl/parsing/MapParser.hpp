@@ -10,8 +10,10 @@
 #include "../Result.hpp"
 #include "../always_false.hpp"
 #include "MapReader.hpp"
+#include "NumericKeyName.hpp"
 #include "Parent.hpp"
 #include "Parser_base.hpp"
+#include "reserve_capacity.hpp"
 #include "schema/Type.hpp"
 #include "schemaful/IsSchemafulReader.hpp"
 #include "schemaful/IsSchemafulWriter.hpp"
@@ -71,6 +73,7 @@ struct MapParser {
         return error(*err);
       }
     } else {
+      reserve_capacity_for_object(_r, _obj_or_map, &map);
       const auto err = _r.read_object(map_reader, _obj_or_map);
       if (err) {
         return error(*err);
@@ -96,8 +99,8 @@ struct MapParser {
 
         if constexpr (std::is_integral_v<ReflT> ||
                       std::is_floating_point_v<ReflT>) {
-          const auto name = std::to_string(k.reflection());
-          const auto new_parent = ParentMapType{name, &m};
+          const auto name = NumericKeyName(k.reflection());
+          const auto new_parent = ParentMapType{name.str(), &m};
           Parser<R, W, std::remove_cvref_t<ValueType>, ProcessorsType>::write(
               _w, v, new_parent);
         } else {
@@ -109,8 +112,8 @@ struct MapParser {
 
       } else if constexpr (std::is_integral_v<KeyType> ||
                            std::is_floating_point_v<KeyType>) {
-        const auto name = std::to_string(k);
-        const auto new_parent = ParentMapType{name, &m};
+        const auto name = NumericKeyName(k);
+        const auto new_parent = ParentMapType{name.str(), &m};
         Parser<R, W, std::remove_cvref_t<ValueType>, ProcessorsType>::write(
             _w, v, new_parent);
       } else {
@@ -132,8 +135,9 @@ struct MapParser {
 
         if constexpr (std::is_integral_v<ReflT> ||
                       std::is_floating_point_v<ReflT>) {
-          const auto name = std::to_string(k.reflection());
-          const auto new_parent = typename ParentType::Object{name, &obj};
+          const auto name = NumericKeyName(k.reflection());
+          const auto new_parent =
+              typename ParentType::Object{name.str(), &obj};
           Parser<R, W, std::remove_cvref_t<ValueType>, ProcessorsType>::write(
               _w, v, new_parent);
         } else {
@@ -145,8 +149,9 @@ struct MapParser {
 
       } else if constexpr (std::is_integral_v<KeyType> ||
                            std::is_floating_point_v<KeyType>) {
-        const auto name = std::to_string(k);
-        const auto new_parent = typename ParentType::Object{name, &obj};
+        const auto name = NumericKeyName(k);
+        const auto new_parent =
+            typename ParentType::Object{name.str(), &obj};
         Parser<R, W, std::remove_cvref_t<ValueType>, ProcessorsType>::write(
             _w, v, new_parent);
       } else {
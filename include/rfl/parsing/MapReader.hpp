@@ -1,14 +1,16 @@
 #ifndef RFL_PARSING_MAPREADER_HPP_
 #define RFL_PARSING_MAPREADER_HPP_
 
+#include <charconv>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "../Result.hpp"
-#include "../always_false.hpp"
+#include "../internal/has_reflection_type_v.hpp"
 
 namespace rfl::parsing {
 
@@ -28,39 +30,50 @@ class MapReader {
 
   void read(const std::string_view& _name,
             const InputVarType& _var) const noexcept {
-    auto res = get_pair(_name, _var);
-    if (res) {
-      map_->emplace(std::move(*res));
-    } else {
-      errors_->push_back(Error("Failed to parse field '" + std::string(_name) +
-                               "': " + res.error().what()));
+    auto val =
+        Parser<R, W, std::remove_cvref_t<ValueType>, ProcessorsType>::read(
+            *r_, _var);
+    if (!val) {
+      add_error(_name, val.error());
+      return;
+    }
+    auto key = make_key(_name);
+    if (!key) {
+      add_error(_name, key.error());
+      return;
     }
+    map_->emplace(std::move(*key), std::move(*val));
   }
 
  private:
+  void add_error(const std::string_view _name, const Error& _err) const {
+    errors_->push_back(Error("Failed to parse field '" + std::string(_name) +
+                             "': " + _err.what()));
+  }
+
+  /// Parses the key directly from the name, without creating a temporary
+  /// std::string and without exceptions.
   template <class T>
-  Result<T> key_to_numeric(auto& _pair) const noexcept {
-    try {
-      if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
-        return static_cast<T>(std::stoll(_pair.first));
-      } else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>) {
-        return static_cast<T>(std::stoull(_pair.first));
-      } else if constexpr (std::is_floating_point_v<T>) {
-        return static_cast<T>(std::stod(_pair.first));
-      } else {
-        static_assert(always_false_v<T>, "Unsupported type");
-      }
-    } catch (std::exception& e) {
-      return error(e.what());
+  static Result<T> key_to_numeric(const std::string_view _name) noexcept {
+    static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>,
+                  "Unsupported type");
+    using ParseType = std::conditional_t<std::is_same_v<T, bool>, int, T>;
+    ParseType val{};
+    const auto [ptr, ec] =
+        std::from_chars(_name.data(), _name.data() + _name.size(), val);
+    if (ec == std::errc::result_out_of_range) {
+      return error("Key '" + std::string(_name) + "' is out of range.");
+    } else if (ec != std::errc() || ptr != _name.data() + _name.size()) {
+      return error("Could not convert key '" + std::string(_name) +
+                   "' to a number.");
     }
+    return static_cast<T>(val);
   }
 
-  Result<std::pair<KeyType, ValueType>> make_key(auto& _pair) const noexcept {
-    const auto to_pair =
-        [&](auto _key) -> Result<std::pair<KeyType, ValueType>> {
+  static Result<KeyType> make_key(const std::string_view _name) noexcept {
+    const auto to_key = [](auto&& _k) -> Result<KeyType> {
       try {
-        return std::make_pair(KeyType(std::move(_key)),
-                              std::move(_pair.second));
+        return KeyType(std::move(_k));
       } catch (std::exception& e) {
         return error(e.what());
       }
@@ -68,34 +81,23 @@ class MapReader {
 
     if constexpr (std::is_integral_v<KeyType> ||
                   std::is_floating_point_v<KeyType>) {
-      return key_to_numeric<KeyType>(_pair).and_then(to_pair);
+      return key_to_numeric<KeyType>(_name);
 
     } else if constexpr (internal::has_reflection_type_v<KeyType>) {
       using ReflT = typename KeyType::ReflectionType;
 
       if constexpr (std::is_integral_v<ReflT> ||
                     std::is_floating_point_v<ReflT>) {
-        return key_to_numeric<ReflT>(_pair).and_then(to_pair);
+        return key_to_numeric<ReflT>(_name).and_then(to_key);
       } else {
-        return to_pair(_pair.first);
+        return to_key(std::string(_name));
       }
 
     } else {
-      return std::move(_pair);
+      return KeyType(_name);
     }
   }
 
-  Result<std::pair<KeyType, ValueType>> get_pair(
-      const std::string_view& _name, const InputVarType& _var) const noexcept {
-    const auto to_pair = [&](ValueType&& _val) {
-      auto pair = std::make_pair(std::string(_name), std::move(_val));
-      return make_key(pair);
-    };
-    return Parser<R, W, std::remove_cvref_t<ValueType>, ProcessorsType>::read(
-               *r_, _var)
-        .and_then(to_pair);
-  }
-
  private:
   /// The underlying reader.
   const R* r_;
@@ -3,6 +3,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <tuple>
 #include <type_traits>
@@ -25,6 +26,7 @@
 #include "Parent.hpp"
 #include "Parser_base.hpp"
 #include "ViewReader.hpp"
+#include "ViewReaderInPlace.hpp"
 #include "ViewReaderWithDefault.hpp"
 #include "ViewReaderWithDefaultAndStrippedFieldNames.hpp"
 #include "ViewReaderWithStrippedFieldNames.hpp"
@@ -145,6 +147,37 @@ struct NamedTupleParser {
     }
   }
 
+  /// Reads the data into a view pointing to fields that already exist,
+  /// overwriting them in place. Fields that are not required and missing from
+  /// _var are reset to their default value.
+  static std::optional<Error> read_view_in_place(
+      const R& _r, const InputVarType& _var,
+      NamedTuple<FieldTypes...>* _view) noexcept {
+    static_assert(
+        internal::no_duplicate_field_names<typename NamedTupleType::Fields>());
+    static_assert(!_no_field_names,
+                  "NoFieldNames is not supported for reading in place.");
+    auto obj = _r.to_object(_var);
+    if (!obj) [[unlikely]] {
+      return obj.error();
+    }
+    auto found = std::array<bool, NamedTupleType::size()>();
+    found.fill(false);
+    std::vector<Error> errors;
+    const auto reader = ViewReaderInPlace<R, W, NamedTupleType, ProcessorsType>(
+        &_r, _view, &found, &errors);
+    const auto err = _r.read_object(reader, *obj);
+    if (err) {
+      return err;
+    }
+    reset_missing_fields(found, _view, &errors,
+                         std::make_integer_sequence<int, size_>());
+    if (errors.size() != 0) {
+      return to_single_error_message(errors);
+    }
+    return std::nullopt;
+  }
+
   template <class P>
   static void write(const W& _w, const NamedTuple<FieldTypes...>& _tup,
                     const P& _parent) noexcept {
@@ -184,7 +217,8 @@ struct NamedTupleParser {
     } else if constexpr (!_all_required && !_no_field_names &&
                          !is_required<ValueType, _ignore_empty_containers>()) {
       constexpr auto name = FieldType::name_.string_view();
-      const auto new_parent = make_parent(name, _ptr);
+      const auto new_parent =
+          make_parent(name, _ptr, /*_has_static_name=*/true);
       if (!is_empty(value)) {
         if constexpr (internal::is_attribute_v<ValueType>) {
           Parser<R, W, ValueType, ProcessorsType>::write(
@@ -195,7 +229,8 @@ struct NamedTupleParser {
       }
     } else {
       constexpr auto name = FieldType::name_.string_view();
-      const auto new_parent = make_parent(name, _ptr);
+      const auto new_parent =
+          make_parent(name, _ptr, /*_has_static_name=*/true);
       if constexpr (internal::is_attribute_v<ValueType>) {
         Parser<R, W, ValueType, ProcessorsType>::write(
             _w, value, new_parent.as_attribute());
@@ -286,12 +321,56 @@ struct NamedTupleParser {
     (handle_one_missing_field<_is>(_found, _view, _set, _errors), ...);
   }
 
+  /// Resets fields that have not been found to their default value or
+  /// generates error messages, if they are required.
+  template <int _i>
+  static void reset_one_missing_field(const std::array<bool, size_>& _found,
+                                      NamedTupleType* _view,
+                                      std::vector<Error>* _errors) noexcept {
+    using FieldType = internal::nth_element_t<_i, FieldTypes...>;
+    using OriginalType = typename FieldType::Type;
+    using ValueType =
+        std::remove_cv_t<std::remove_reference_t<std::remove_pointer_t<
+            typename FieldType::Type>>>;
+
+    if (!std::get<_i>(_found)) {
+      constexpr bool is_required_field =
+          !internal::is_extra_fields_v<ValueType> &&
+          (_all_required || is_required<ValueType, _ignore_empty_containers>());
+      if constexpr (is_required_field) {
+        constexpr auto current_name =
+            internal::nth_element_t<_i, FieldTypes...>::name();
+        std::stringstream stream;
+        stream << "Field named '" << std::string(current_name)
+               << "' not found.";
+        _errors->emplace_back(Error(stream.str()));
+      } else if constexpr (std::is_pointer_v<OriginalType>) {
+        auto ptr = const_cast<ValueType*>(rfl::get<_i>(*_view));
+        std::destroy_at(ptr);
+        ::new (ptr) ValueType();
+      } else {
+        rfl::get<_i>(*_view) = ValueType();
+      }
+    }
+  }
+
+  template <int... _is>
+  static void reset_missing_fields(const std::array<bool, size_>& _found,
+                                   NamedTupleType* _view,
+                                   std::vector<Error>* _errors,
+                                   std::integer_sequence<int, _is...>) noexcept {
+    (reset_one_missing_field<_is>(_found, _view, _errors), ...);
+  }
+
   static auto make_parent(const std::string_view& _name,
-                          OutputObjectOrArrayType* _ptr) {
+                          OutputObjectOrArrayType* _ptr,
+                          const bool _has_static_name = false) {
     if constexpr (_no_field_names) {
       return typename ParentType::Array{_ptr};
     } else {
-      return typename ParentType::Object{_name, _ptr};
+      return typename ParentType::Object{.name_ = _name,
+                                         .obj_ = _ptr,
+                                         .has_static_name_ = _has_static_name};
     }
   }
 
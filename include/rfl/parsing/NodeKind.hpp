@@ -0,0 +1,14 @@
+#ifndef RFL_PARSING_NODEKIND_HPP_
+#define RFL_PARSING_NODEKIND_HPP_
+
+namespace rfl::parsing {
+
+/// A coarse classification of an input variable. Readers can report it, so
+/// that alternatives of an untagged variant that cannot possibly match can be
+/// skipped without attempting to parse them. NodeKind::unknown means that the
+/// reader cannot (or will not) tell, which never rules anything out.
+enum class NodeKind { unknown, null, boolean, number, string, array, object };
+
+}  // namespace rfl::parsing
+
+#endif
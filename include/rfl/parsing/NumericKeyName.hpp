@@ -0,0 +1,58 @@
+#ifndef RFL_PARSING_NUMERICKEYNAME_HPP_
+#define RFL_PARSING_NUMERICKEYNAME_HPP_
+
+#include <array>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace rfl::parsing {
+
+/// Formats a numeric map key for use as a field name. Integral keys are
+/// written into a buffer on the stack, so no std::string needs to be
+/// allocated. Floating point keys go through std::to_string, to keep their
+/// format unchanged.
+template <class T>
+class NumericKeyName {
+  static constexpr bool is_integral_ = std::is_integral_v<T>;
+
+ public:
+  explicit NumericKeyName(const T _key) {
+    if constexpr (is_integral_) {
+      using FormatType = std::conditional_t<std::is_same_v<T, bool>, int, T>;
+      const auto res =
+          std::to_chars(data_.data(), data_.data() + data_.size() - 1,
+                        static_cast<FormatType>(_key));
+      *res.ptr = '\0';
+      size_ = static_cast<size_t>(res.ptr - data_.data());
+    } else {
+      data_ = std::to_string(_key);
+    }
+  }
+
+  NumericKeyName(const NumericKeyName&) = delete;
+
+  NumericKeyName& operator=(const NumericKeyName&) = delete;
+
+  /// The formatted key, which is valid for as long as this object is. It is
+  /// always null-terminated, because some writers rely on that.
+  std::string_view str() const noexcept {
+    if constexpr (is_integral_) {
+      return std::string_view(data_.data(), size_);
+    } else {
+      return data_;
+    }
+  }
+
+ private:
+  /// Large enough for any 64-bit integer, including the sign.
+  std::conditional_t<is_integral_, std::array<char, 24>, std::string> data_;
+
+  /// The number of characters used in data_, for integral keys only.
+  size_t size_ = 0;
+};
+
+}  // namespace rfl::parsing
+
+#endif
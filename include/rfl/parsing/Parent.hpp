@@ -7,7 +7,9 @@
 
 #include "../always_false.hpp"
 #include "schemaful/IsSchemafulWriter.hpp"
+#include "StaticName.hpp"
 #include "supports_attributes.hpp"
+#include "supports_static_names.hpp"
 
 namespace rfl::parsing {
 
@@ -32,7 +34,13 @@ struct Parent {
     std::string_view name_;
     OutputObjectType* obj_;
     bool is_attribute_ = false;
-    Object as_attribute() const { return Object{name_, obj_, true}; }
+
+    /// Whether name_ is known at compile time, see StaticName.
+    bool has_static_name_ = false;
+
+    Object as_attribute() const {
+      return Object{name_, obj_, true, has_static_name_};
+    }
   };
 
   // For schemaful formats only.
@@ -52,6 +60,12 @@ struct Parent {
       return _w.add_array_to_array(_size, _parent.arr_);
 
     } else if constexpr (std::is_same<Type, Object>()) {
+      if constexpr (supports_static_names<std::remove_cvref_t<W>>) {
+        if (_parent.has_static_name_) {
+          return _w.add_array_to_object(StaticName{_parent.name_}, _size,
+                                        _parent.obj_);
+        }
+      }
       return _w.add_array_to_object(_parent.name_, _size, _parent.obj_);
 
     } else if constexpr (std::is_same<Type, Root>()) {
@@ -106,6 +120,12 @@ struct Parent {
       return _w.add_object_to_array(_size, _parent.arr_);
 
     } else if constexpr (std::is_same<Type, Object>()) {
+      if constexpr (supports_static_names<std::remove_cvref_t<W>>) {
+        if (_parent.has_static_name_) {
+          return _w.add_object_to_object(StaticName{_parent.name_}, _size,
+                                         _parent.obj_);
+        }
+      }
       return _w.add_object_to_object(_parent.name_, _size, _parent.obj_);
 
     } else if constexpr (std::is_same<Type, Root>()) {
@@ -137,6 +157,12 @@ struct Parent {
         return _w.add_null_to_object(_parent.name_, _parent.obj_,
                                      _parent.is_attribute_);
       } else {
+        if constexpr (supports_static_names<std::remove_cvref_t<W>>) {
+          if (_parent.has_static_name_) {
+            return _w.add_null_to_object(StaticName{_parent.name_},
+                                         _parent.obj_);
+          }
+        }
         return _w.add_null_to_object(_parent.name_, _parent.obj_);
       }
 
@@ -195,6 +221,12 @@ struct Parent {
         return _w.add_value_to_object(_parent.name_, _var, _parent.obj_,
                                       _parent.is_attribute_);
       } else {
+        if constexpr (supports_static_names<std::remove_cvref_t<W>>) {
+          if (_parent.has_static_name_) {
+            return _w.add_value_to_object(StaticName{_parent.name_}, _var,
+                                          _parent.obj_);
+          }
+        }
         return _w.add_value_to_object(_parent.name_, _var, _parent.obj_);
       }
 
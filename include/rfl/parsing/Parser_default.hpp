@@ -23,6 +23,7 @@
 #include "../internal/to_ptr_named_tuple.hpp"
 #include "../to_view.hpp"
 #include "AreReaderAndWriter.hpp"
+#include "IsReader.hpp"
 #include "Parent.hpp"
 #include "Parser_base.hpp"
 #include "call_destructors_where_necessary.hpp"
@@ -91,8 +92,13 @@ struct Parser {
               *_r.template to_basic_type<std::underlying_type_t<T>>(_var));
         } else {
           using StringConverter = internal::enums::StringConverter<T>;
-          return _r.template to_basic_type<std::string>(_var).and_then(
-              StringConverter::string_to_enum);
+          if constexpr (SupportsStringView<R>) {
+            return _r.to_string_view(_var).and_then(
+                StringConverter::string_to_enum);
+          } else {
+            return _r.template to_basic_type<std::string>(_var).and_then(
+                StringConverter::string_to_enum);
+          }
         }
 
       } else {
@@ -0,0 +1,56 @@
+#ifndef RFL_PARSING_PARSER_SPAN_HPP_
+#define RFL_PARSING_PARSER_SPAN_HPP_
+
+#include <cstddef>
+#include <map>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "../Bytestring.hpp"
+#include "../Result.hpp"
+#include "../always_false.hpp"
+#include "IsReader.hpp"
+#include "Parser_base.hpp"
+#include "schema/Type.hpp"
+
+namespace rfl {
+namespace parsing {
+
+template <class R, class W, class ProcessorsType>
+  requires AreReaderAndWriter<R, W, std::span<const std::byte>>
+struct Parser<R, W, std::span<const std::byte>, ProcessorsType> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<std::span<const std::byte>> read(
+      const R& _r, const InputVarType& _var) noexcept {
+    if constexpr (ProcessorsType::allow_borrowing_ && SupportsBytesView<R>) {
+      return _r.to_bytes_view(_var);
+    } else {
+      static_assert(always_false_v<R>,
+                    "Reading into std::span<const std::byte> is only "
+                    "supported by read_borrowed(...), which keeps the "
+                    "underlying document alive, and only for formats that "
+                    "support binary data. Please consider using "
+                    "rfl::Bytestring instead.");
+      return error("Unsupported.");
+    }
+  }
+
+  template <class P>
+  static void write(const W& _w, const std::span<const std::byte>& _bytes,
+                    const P& _p) noexcept {
+    Parser<R, W, Bytestring, ProcessorsType>::write(
+        _w, Bytestring(_bytes.begin(), _bytes.end()), _p);
+  }
+
+  static schema::Type to_schema(
+      std::map<std::string, schema::Type>* _definitions) {
+    return Parser<R, W, Bytestring, ProcessorsType>::to_schema(_definitions);
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -8,6 +8,8 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "IsReader.hpp"
+#include "Parent.hpp"
 #include "Parser_base.hpp"
 #include "schema/Type.hpp"
 
@@ -18,19 +20,27 @@ template <class R, class W, class ProcessorsType>
   requires AreReaderAndWriter<R, W, std::string_view>
 struct Parser<R, W, std::string_view, ProcessorsType> {
   using InputVarType = typename R::InputVarType;
-
-  static Result<std::string_view> read(const R&, const InputVarType&) noexcept {
-    static_assert(always_false_v<R>,
-                  "Reading into std::string_view is dangerous and "
-                  "therefore unsupported. "
-                  "Please consider using std::string instead.");
-    return error("Unsupported.");
+  using ParentType = Parent<W>;
+
+  static Result<std::string_view> read(const R& _r,
+                                       const InputVarType& _var) noexcept {
+    if constexpr (ProcessorsType::allow_borrowing_ && SupportsStringView<R>) {
+      return _r.to_string_view(_var);
+    } else {
+      static_assert(always_false_v<R>,
+                    "Reading into std::string_view is dangerous and "
+                    "therefore unsupported, unless you use read_borrowed(...), "
+                    "which keeps the underlying document alive and is "
+                    "supported for JSON, msgpack and flexbuffers. "
+                    "Please consider using std::string instead.");
+      return error("Unsupported.");
+    }
   }
 
   template <class P>
   static void write(const W& _w, const std::string_view& _str,
                     const P& _p) noexcept {
-    Parser<R, W, std::string, ProcessorsType>::write(_w, std::string(_str), _p);
+    ParentType::add_value(_w, _str, _p);
   }
 
   static schema::Type to_schema(
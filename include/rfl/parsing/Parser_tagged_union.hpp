@@ -1,8 +1,11 @@
 #ifndef RFL_PARSING_PARSER_TAGGED_UNION_HPP_
 #define RFL_PARSING_PARSER_TAGGED_UNION_HPP_
 
+#include <array>
 #include <map>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "../Result.hpp"
@@ -10,6 +13,7 @@
 #include "../always_false.hpp"
 #include "../internal/strings/strings.hpp"
 #include "../named_tuple_t.hpp"
+#include "IsReader.hpp"
 #include "Parser_base.hpp"
 #include "TaggedUnionWrapper.hpp"
 #include "is_tagged_union_wrapper.hpp"
@@ -38,6 +42,14 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
       std::conditional_t<no_field_names_, typename R::InputArrayType,
                          typename R::InputObjectType>;
 
+  /// If the reader supports it, the discriminator is never copied into a
+  /// std::string.
+  using DiscriminatorType = std::conditional_t<SupportsStringView<R>,
+                                               std::string_view, std::string>;
+
+  using PossibleTags =
+      possible_tags_t<TaggedUnion<_discriminator, AlternativeTypes...>>;
+
   static ResultType read(const R& _r, const InputVarType& _var) noexcept {
     if constexpr (schemaful::IsSchemafulReader<R>) {
       return Parser<R, W, Variant<AlternativeTypes...>, ProcessorsType>::read(
@@ -48,16 +60,14 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
           });
 
     } else {
-      const auto get_disc =
-          [&_r](InputObjectOrArrayType _obj_or_arr) -> Result<std::string> {
+      const auto get_disc = [&_r](InputObjectOrArrayType _obj_or_arr)
+          -> Result<DiscriminatorType> {
         return get_discriminator(_r, _obj_or_arr);
       };
 
       const auto to_result =
-          [&_r, _var](const std::string& _disc_value) -> ResultType {
-        return find_matching_alternative(
-            _r, _disc_value, _var,
-            std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
+          [&_r, _var](const DiscriminatorType& _disc_value) -> ResultType {
+        return find_matching_alternative(_r, _disc_value, _var);
       };
 
       if constexpr (no_field_names_) {
@@ -96,20 +106,39 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
   }
 
  private:
+  using ReadAlternativeType = ResultType (*)(const R&, std::string_view,
+                                             const InputVarType&);
+
+  /// Maps the position of a tag within PossibleTags to the alternative it
+  /// belongs to. An alternative may have several tags.
+  static constexpr auto make_alternative_indices() {
+    constexpr std::array<size_t, sizeof...(AlternativeTypes)> num_tags = {
+        static_cast<size_t>(
+            internal::tag_t<_discriminator, AlternativeTypes>::num_fields_)...};
+    std::array<int, PossibleTags::num_fields_> alternative_indices{};
+    size_t pos = 0;
+    for (size_t i = 0; i < num_tags.size(); ++i) {
+      for (size_t j = 0; j < num_tags[i]; ++j) {
+        alternative_indices[pos++] = static_cast<int>(i);
+      }
+    }
+    return alternative_indices;
+  }
+
   template <int... _is>
+  static constexpr auto make_readers(std::integer_sequence<int, _is...>) {
+    return std::array<ReadAlternativeType, sizeof...(_is)>{
+        &read_alternative<_is>...};
+  }
+
   static ResultType find_matching_alternative(
-      const R& _r, const std::string& _disc_value, const InputVarType& _var,
-      std::integer_sequence<int, _is...>) noexcept {
-    using PossibleTags =
-        possible_tags_t<TaggedUnion<_discriminator, AlternativeTypes...>>;
+      const R& _r, const std::string_view _disc_value,
+      const InputVarType& _var) noexcept {
     static_assert(!PossibleTags::has_duplicates(),
                   "Duplicate tags are not allowed inside tagged unions.");
-    ResultType res = error("");
-    bool match_found = false;
-    (set_if_disc_value_matches<_is>(_r, _disc_value, _var, &res, &match_found),
-     ...);
-    if (match_found) [[likely]] {
-      return res;
+    const auto ix = PossibleTags::find_index(_disc_value);
+    if (ix != -1) [[likely]] {
+      return readers_[alternative_indices_[ix]](_r, _disc_value, _var);
     } else {
       const auto names = PossibleTags::names();
       std::stringstream stream;
@@ -122,59 +151,56 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
   }
 
   template <int _i>
-  static void set_if_disc_value_matches(const R& _r,
-                                        const std::string& _disc_value,
-                                        const InputVarType& _var,
-                                        ResultType* _res,
-                                        bool* _match_found) noexcept {
+  static ResultType read_alternative(const R& _r,
+                                     const std::string_view _disc_value,
+                                     const InputVarType& _var) noexcept {
     using AlternativeType = std::remove_cvref_t<
         std::variant_alternative_t<_i, std::variant<AlternativeTypes...>>>;
 
-    if (!*_match_found && contains_disc_value<AlternativeType>(_disc_value)) {
-      const auto get_fields = [](auto&& _val) -> AlternativeType {
-        if constexpr (is_tagged_union_wrapper_v<decltype(_val)>) {
-          return std::move(_val.fields());
-        } else {
-          return std::move(_val);
-        }
-      };
-
-      const auto to_tagged_union = [](auto&& _val) {
-        return TaggedUnion<_discriminator, AlternativeTypes...>(
-            std::move(_val));
-      };
-
-      const auto embellish_error = [&](auto&& _e) {
-        std::stringstream stream;
-        stream << "Could not parse tagged union with "
-                  "discrimininator "
-               << _discriminator.str() << " '" << _disc_value
-               << "': " << _e.what();
-        return Error(stream.str());
-      };
-
-      if constexpr (no_field_names_) {
-        using T = tagged_union_wrapper_no_ptr_t<std::invoke_result_t<
-            decltype(wrap_if_necessary<AlternativeType>), AlternativeType>>;
-        *_res = Parser<R, W, T, ProcessorsType>::read(_r, _var)
-                    .transform(get_fields)
-                    .transform(to_tagged_union)
-                    .transform_error(embellish_error);
+    const auto get_fields = [](auto&& _val) -> AlternativeType {
+      if constexpr (is_tagged_union_wrapper_v<decltype(_val)>) {
+        return std::move(_val.fields());
       } else {
-        *_res = Parser<R, W, AlternativeType, ProcessorsType>::read(_r, _var)
-                    .transform(to_tagged_union)
-                    .transform_error(embellish_error);
+        return std::move(_val);
       }
+    };
 
-      *_match_found = true;
+    const auto to_tagged_union = [](auto&& _val) {
+      return TaggedUnion<_discriminator, AlternativeTypes...>(std::move(_val));
+    };
+
+    const auto embellish_error = [&](auto&& _e) {
+      std::stringstream stream;
+      stream << "Could not parse tagged union with "
+                "discrimininator "
+             << _discriminator.str() << " '" << _disc_value
+             << "': " << _e.what();
+      return Error(stream.str());
+    };
+
+    if constexpr (no_field_names_) {
+      using T = tagged_union_wrapper_no_ptr_t<std::invoke_result_t<
+          decltype(wrap_if_necessary<AlternativeType>), AlternativeType>>;
+      return Parser<R, W, T, ProcessorsType>::read(_r, _var)
+          .transform(get_fields)
+          .transform(to_tagged_union)
+          .transform_error(embellish_error);
+    } else {
+      return Parser<R, W, AlternativeType, ProcessorsType>::read(_r, _var)
+          .transform(to_tagged_union)
+          .transform_error(embellish_error);
     }
   }
 
   /// Retrieves the discriminator from an object
-  static Result<std::string> get_discriminator(
+  static Result<DiscriminatorType> get_discriminator(
       const R& _r, const InputObjectOrArrayType& _obj_or_arr) noexcept {
     const auto to_type = [&_r](auto _var) {
-      return _r.template to_basic_type<std::string>(_var);
+      if constexpr (SupportsStringView<R>) {
+        return _r.to_string_view(_var);
+      } else {
+        return _r.template to_basic_type<std::string>(_var);
+      }
     };
 
     const auto embellish_error = [](const auto&) {
@@ -195,14 +221,6 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
     }
   }
 
-  /// Determines whether the discriminating literal contains the value
-  /// retrieved from the object.
-  template <class T>
-  static inline bool contains_disc_value(
-      const std::string& _disc_value) noexcept {
-    return internal::tag_t<_discriminator, T>::contains(_disc_value);
-  }
-
   /// Writes a wrapped version of the original object, which contains the tag.
   template <class T, class P>
   static void write_wrapped(const W& _w, const T& _val,
@@ -233,6 +251,11 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
       }
     }
   }
+
+  static constexpr auto alternative_indices_ = make_alternative_indices();
+
+  static constexpr auto readers_ = make_readers(
+      std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
 };
 
 }  // namespace rfl::parsing
@@ -0,0 +1,70 @@
+#ifndef RFL_PARSING_PARSER_TIMESTAMP_HPP_
+#define RFL_PARSING_PARSER_TIMESTAMP_HPP_
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "../Result.hpp"
+#include "../Timestamp.hpp"
+#include "../internal/StringLiteral.hpp"
+#include "Parent.hpp"
+#include "Parser_base.hpp"
+#include "SupportsTimestamps.hpp"
+#include "schema/Type.hpp"
+
+namespace rfl {
+namespace parsing {
+
+template <class R, class W, internal::StringLiteral _format,
+          class ProcessorsType>
+  requires AreReaderAndWriter<R, W, Timestamp<_format>>
+struct Parser<R, W, Timestamp<_format>, ProcessorsType> {
+  using InputVarType = typename R::InputVarType;
+  using ParentType = Parent<W>;
+  using TimestampType = Timestamp<_format>;
+
+  /// Whether the time stamp is encoded using the native type of the format
+  /// rather than as a string.
+  static constexpr bool is_native_ = ProcessorsType::native_timestamps_ &&
+                                     SupportsTimestamps<R> &&
+                                     SupportsTimestamps<W>;
+
+  static Result<TimestampType> read(const R& _r,
+                                    const InputVarType& _var) noexcept {
+    if constexpr (is_native_) {
+      return _r.template to_basic_type<std::chrono::sys_seconds>(_var)
+          .transform([](const auto& _t) { return TimestampType(_t); });
+    } else {
+      return Parser<R, W, std::string, ProcessorsType>::read(_r, _var)
+          .and_then([](const std::string& _str) {
+            return TimestampType::from_string(_str);
+          });
+    }
+  }
+
+  template <class P>
+  static void write(const W& _w, const TimestampType& _t,
+                    const P& _parent) noexcept {
+    if constexpr (is_native_) {
+      ParentType::add_value(_w, _t.time_point(), _parent);
+    } else {
+      Parser<R, W, std::string, ProcessorsType>::write(_w, _t.str(), _parent);
+    }
+  }
+
+  static schema::Type to_schema(
+      std::map<std::string, schema::Type>* _definitions) {
+    if constexpr (is_native_) {
+      return schema::Type{schema::Type::Timestamp{}};
+    } else {
+      return Parser<R, W, std::string, ProcessorsType>::to_schema(
+          _definitions);
+    }
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
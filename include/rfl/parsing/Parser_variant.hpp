@@ -15,12 +15,12 @@
 #include "FieldVariantParser.hpp"
 #include "Parent.hpp"
 #include "Parser_base.hpp"
+#include "UntaggedVariantParser.hpp"
 #include "VariantAlternativeWrapper.hpp"
 #include "schema/Type.hpp"
 #include "schemaful/IsSchemafulReader.hpp"
 #include "schemaful/IsSchemafulWriter.hpp"
 #include "schemaful/VariantReader.hpp"
-#include "to_single_error_message.hpp"
 
 namespace rfl::parsing {
 
@@ -83,21 +83,10 @@ class Parser<R, W, std::variant<AlternativeTypes...>, ProcessorsType> {
           });
 
     } else {
-      std::optional<std::variant<AlternativeTypes...>> result;
-      std::vector<Error> errors;
-      read_variant(
-          _r, _var, &result, &errors,
-          std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
-      if (result) {
-        return std::move(*result);
-      } else {
-        return error(
-            to_single_error_message(errors,
-                                    "Could not parse the variant. Each of the "
-                                    "possible alternatives failed "
-                                    "for the following reasons: ",
-                                    100000));
-      }
+      using VariantParserType =
+          UntaggedVariantParser<R, W, std::variant<AlternativeTypes...>,
+                                ProcessorsType, AlternativeTypes...>;
+      return VariantParserType::read(_r, _var);
     }
   }
 
@@ -202,32 +191,6 @@ class Parser<R, W, std::variant<AlternativeTypes...>, ProcessorsType> {
                            std::integer_sequence<int, _is...>) noexcept {
     (add_to_schema<_is>(_definitions, _types), ...);
   }
-
-  template <int _i>
-  static void read_one_alternative(
-      const R& _r, const InputVarType& _var,
-      std::optional<std::variant<AlternativeTypes...>>* _result,
-      std::vector<Error>* _errors) noexcept {
-    if (!*_result) {
-      using AltType =
-          std::remove_cvref_t<internal::nth_element_t<_i, AlternativeTypes...>>;
-      auto res = Parser<R, W, AltType, ProcessorsType>::read(_r, _var);
-      if (res) {
-        *_result = std::move(*res);
-      } else {
-        _errors->emplace_back(res.error());
-      }
-    }
-  }
-
-  template <int... _is>
-  static void read_variant(
-      const R& _r, const InputVarType& _var,
-      std::optional<std::variant<AlternativeTypes...>>* _result,
-      std::vector<Error>* _errors,
-      std::integer_sequence<int, _is...>) noexcept {
-    (read_one_alternative<_is>(_r, _var, _result, _errors), ...);
-  }
 };
 
 }  // namespace rfl::parsing
@@ -0,0 +1,17 @@
+#ifndef RFL_PARSING_STATICNAME_HPP_
+#define RFL_PARSING_STATICNAME_HPP_
+
+#include <string_view>
+
+namespace rfl::parsing {
+
+/// The name of a field that is known at compile time, such as
+/// rfl::Field::name_. It points to static storage, so writers may reference
+/// it for as long as they like instead of copying it.
+struct StaticName {
+  std::string_view str_;
+};
+
+}  // namespace rfl::parsing
+
+#endif
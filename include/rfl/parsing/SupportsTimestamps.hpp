@@ -0,0 +1,19 @@
+#ifndef RFL_PARSING_SUPPORTSTIMESTAMPS_HPP_
+#define RFL_PARSING_SUPPORTSTIMESTAMPS_HPP_
+
+namespace rfl::parsing {
+
+/// Readers and writers can optionally declare that the format has a native
+/// type for points in time, which rfl::NativeTimestamps then uses to encode
+/// rfl::Timestamp:
+///
+///   static constexpr bool supports_timestamps = true;
+///
+/// Such readers must accept std::chrono::sys_seconds in to_basic_type and
+/// such writers must accept it as a basic value.
+template <class T>
+concept SupportsTimestamps = requires { requires T::supports_timestamps; };
+
+}  // namespace rfl::parsing
+
+#endif
@@ -0,0 +1,207 @@
+#ifndef RFL_PARSING_UNTAGGEDVARIANTPARSER_HPP_
+#define RFL_PARSING_UNTAGGEDVARIANTPARSER_HPP_
+
+#include <array>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../Tuple.hpp"
+#include "../internal/has_reflection_type_v.hpp"
+#include "../internal/has_reflector.hpp"
+#include "../internal/is_extra_fields.hpp"
+#include "../internal/is_literal.hpp"
+#include "../internal/nth_element_t.hpp"
+#include "../internal/processed_t.hpp"
+#include "IsReader.hpp"
+#include "NodeKind.hpp"
+#include "Parser_base.hpp"
+#include "is_required.hpp"
+#include "to_single_error_message.hpp"
+
+namespace rfl::parsing {
+
+/// Parses a variant that contains no tags by trying each of the alternatives
+/// in order. If the reader can classify its input (see SupportsNodeKind),
+/// alternatives whose shape cannot possibly match are skipped without
+/// attempting to parse them. For objects, this includes checking for the
+/// required fields (see SupportsHasField). The skipped alternatives are only
+/// parsed if all others have failed, so the error message is the same as if
+/// there was no prefiltering at all.
+template <class R, class W, class VariantType, class ProcessorsType,
+          class... AlternativeTypes>
+struct UntaggedVariantParser {
+  using InputVarType = typename R::InputVarType;
+
+  static constexpr size_t size_ = sizeof...(AlternativeTypes);
+
+  using Errors = std::array<std::optional<Error>, size_>;
+
+  static Result<VariantType> read(const R& _r,
+                                  const InputVarType& _var) noexcept {
+    const auto kind = get_node_kind(_r, _var);
+    std::optional<VariantType> result;
+    Errors errors;
+    read_variant</*_prefilter=*/true>(
+        _r, _var, kind, &result, &errors,
+        std::make_integer_sequence<int, size_>());
+    if (result) [[likely]] {
+      return std::move(*result);
+    }
+    read_variant</*_prefilter=*/false>(
+        _r, _var, kind, &result, &errors,
+        std::make_integer_sequence<int, size_>());
+    if (result) {
+      return std::move(*result);
+    }
+    std::vector<Error> error_vec;
+    error_vec.reserve(size_);
+    for (auto& err : errors) {
+      error_vec.emplace_back(std::move(*err));
+    }
+    return error(
+        to_single_error_message(std::move(error_vec),
+                                "Could not parse the variant. Each of the "
+                                "possible alternatives failed "
+                                "for the following reasons: ",
+                                100000));
+  }
+
+ private:
+  static NodeKind get_node_kind(const R& _r, const InputVarType& _var) {
+    if constexpr (SupportsNodeKind<R>) {
+      return _r.node_kind(_var);
+    } else {
+      return NodeKind::unknown;
+    }
+  }
+
+  /// The kind of node an alternative requires or NodeKind::unknown, if that
+  /// cannot be inferred from the type alone. This must be conservative: If in
+  /// doubt, return NodeKind::unknown.
+  template <class T>
+  static consteval NodeKind expected_node_kind() {
+    if constexpr (!SupportsNodeKind<R> || internal::has_read_reflector<T> ||
+                  R::template has_custom_constructor<T>) {
+      return NodeKind::unknown;
+    } else if constexpr (std::is_same_v<T, bool>) {
+      return NodeKind::boolean;
+    } else if constexpr (std::is_integral_v<T> || std::is_floating_point_v<T>) {
+      return NodeKind::number;
+    } else if constexpr (std::is_same_v<T, std::string> ||
+                         internal::is_literal_v<T>) {
+      return NodeKind::string;
+    } else if constexpr (is_vector_or_array<T>::value) {
+      return NodeKind::array;
+    } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T> &&
+                         !internal::has_reflection_type_v<T>) {
+      return ProcessorsType::no_field_names_ ? NodeKind::array
+                                             : NodeKind::object;
+    } else {
+      return NodeKind::unknown;
+    }
+  }
+
+  /// Whether the alternative could possibly be parsed from the input.
+  template <class T>
+  static bool can_match(const R& _r, const InputVarType& _var,
+                        const NodeKind _kind) noexcept {
+    constexpr auto expected = expected_node_kind<T>();
+    if constexpr (expected == NodeKind::unknown) {
+      return true;
+    } else {
+      if (_kind == NodeKind::unknown) {
+        return true;
+      }
+      if (_kind != expected) {
+        return false;
+      }
+      if constexpr (expected == NodeKind::object && SupportsHasField<R> &&
+                    !ProcessorsType::default_if_missing_) {
+        using NamedTupleType = internal::processed_t<T, ProcessorsType>;
+        const auto obj = _r.to_object(_var);
+        return !obj || has_required_fields<NamedTupleType>(
+                           _r, *obj,
+                           std::make_integer_sequence<
+                               int, NamedTupleType::size()>());
+      } else {
+        return true;
+      }
+    }
+  }
+
+  template <class NamedTupleType, int... _is>
+  static bool has_required_fields(const R& _r,
+                                  const typename R::InputObjectType& _obj,
+                                  std::integer_sequence<int, _is...>) noexcept {
+    return (has_field_if_required<NamedTupleType, _is>(_r, _obj) && ...);
+  }
+
+  /// Mirrors the logic in NamedTupleParser, which determines whether a
+  /// missing field is an error.
+  template <class NamedTupleType, int _i>
+  static bool has_field_if_required(
+      const R& _r, const typename R::InputObjectType& _obj) noexcept {
+    using FieldType = std::remove_cvref_t<
+        rfl::tuple_element_t<_i, typename NamedTupleType::Fields>>;
+    using ValueType = std::remove_reference_t<
+        std::remove_pointer_t<typename FieldType::Type>>;
+    constexpr bool is_required_field =
+        !internal::is_extra_fields_v<ValueType> &&
+        (ProcessorsType::all_required_ || is_required<ValueType, false>());
+    if constexpr (is_required_field) {
+      return _r.has_field(FieldType::name_.string_view(), _obj);
+    } else {
+      return true;
+    }
+  }
+
+  template <bool _prefilter, int _i>
+  static void read_one_alternative(const R& _r, const InputVarType& _var,
+                                   const NodeKind _kind,
+                                   std::optional<VariantType>* _result,
+                                   Errors* _errors) noexcept {
+    using AltType =
+        std::remove_cvref_t<internal::nth_element_t<_i, AlternativeTypes...>>;
+    if (*_result || (*_errors)[_i]) {
+      return;
+    }
+    if constexpr (_prefilter) {
+      if (!can_match<AltType>(_r, _var, _kind)) {
+        return;
+      }
+    }
+    auto res = Parser<R, W, AltType, ProcessorsType>::read(_r, _var);
+    if (res) {
+      *_result = std::move(*res);
+    } else {
+      (*_errors)[_i] = res.error();
+    }
+  }
+
+  template <bool _prefilter, int... _is>
+  static void read_variant(const R& _r, const InputVarType& _var,
+                           const NodeKind _kind,
+                           std::optional<VariantType>* _result,
+                           Errors* _errors,
+                           std::integer_sequence<int, _is...>) noexcept {
+    (read_one_alternative<_prefilter, _is>(_r, _var, _kind, _result, _errors),
+     ...);
+  }
+
+  template <class T>
+  struct is_vector_or_array : std::false_type {};
+
+  template <class T>
+  struct is_vector_or_array<std::vector<T>> : std::true_type {};
+
+  template <class T, size_t _size>
+  struct is_vector_or_array<std::array<T, _size>> : std::true_type {};
+};
+
+}  // namespace rfl::parsing
+
+#endif
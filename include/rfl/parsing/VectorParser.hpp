@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
@@ -17,6 +18,8 @@
 #include "is_map_like.hpp"
 #include "is_map_like_not_multimap.hpp"
 #include "is_set_like.hpp"
+#include "read_array_in_parallel.hpp"
+#include "reserve_capacity.hpp"
 #include "schema/Type.hpp"
 
 namespace rfl {
@@ -53,6 +56,17 @@ struct VectorParser {
     } else {
       const auto parse = [&](const InputArrayType& _arr) -> Result<VecType> {
         VecType vec;
+        if constexpr (read_in_parallel()) {
+          if (should_read_in_parallel(_r, _arr)) {
+            const auto err =
+                read_array_in_parallel<R, W, T, ProcessorsType>(_r, _arr, &vec);
+            if (err) {
+              return error(*err);
+            }
+            return vec;
+          }
+        }
+        reserve_capacity_for_array(_r, _arr, &vec);
         auto vector_reader =
             VectorReader<R, W, VecType, ProcessorsType>(&_r, &vec);
         const auto err = _r.read_array(vector_reader, _arr);
@@ -96,6 +110,16 @@ struct VectorParser {
   }
 
  private:
+  /// Whether rfl::Parallel applies. The elements are parsed into pre-sized
+  /// storage, which is why they must be default-constructible.
+  /// std::vector<bool> is excluded, because its elements cannot be written
+  /// concurrently.
+  static constexpr bool read_in_parallel() {
+    return ProcessorsType::parallel_ && SupportsParallelReading<R> &&
+           std::is_same<VecType, std::vector<T>>() &&
+           !std::is_same<T, bool>() && std::is_default_constructible_v<T>;
+  }
+
   static constexpr bool treat_as_map() {
     if constexpr (is_map_like_not_multimap<VecType>()) {
       if constexpr (internal::has_reflection_type_v<typename T::first_type>) {
@@ -10,8 +10,11 @@
 
 #include "../Result.hpp"
 #include "../Tuple.hpp"
+#include "../internal/FieldIndexLookup.hpp"
 #include "../internal/is_array.hpp"
+#include "IsReader.hpp"
 #include "Parser_base.hpp"
+#include "move_to.hpp"
 #include "schemaful/IsSchemafulReader.hpp"
 
 namespace rfl::parsing {
@@ -32,59 +35,53 @@ class ViewReader {
   /// Assigns the parsed version of _var to the field signified by _name, if
   /// such a field exists in the underlying view.
   void read(const std::string_view& _name, const InputVarType& _var) const {
-    assign_to_matching_field(*r_, _name, _var, view_, errors_, found_, set_,
-                             std::make_integer_sequence<int, size_>());
+    assign_to_matching_field(*r_, field_lookup_.find(_name), _name, _var,
+                             view_, errors_, found_, set_);
   }
 
   /// Assigns the parsed version of _var to the field signified by _index, if
   /// such a field exists in the underlying view.
   /// Note that schemaful formats can assign by index.
   void read(const int _index, const InputVarType& _var) const {
-    assign_to_matching_field(*r_, _index, _var, view_, errors_, found_, set_,
-                             std::make_integer_sequence<int, size_>());
+    assign_to_matching_field(
+        *r_, _index >= 0 && _index < static_cast<int>(size_) ? _index : -1,
+        _index, _var, view_, errors_, found_, set_);
   }
 
  private:
-  template <int i, class FieldType>
-  static bool is_matching(const int _current_index) {
-    return _current_index == i;
-  }
-
-  template <int i, class FieldType>
-  static bool is_matching(const std::string_view& _current_name) {
-    return _current_name == FieldType::name();
-  }
+  using AssignFieldType = void (*)(const R&, const InputVarType&, ViewType*,
+                                   std::vector<Error>*,
+                                   std::array<bool, size_>*);
 
   template <int i>
-  static void assign_if_field_matches(const R& _r,
-                                      const auto _current_name_or_index,
-                                      const auto& _var, auto* _view,
-                                      auto* _errors, auto* _found, auto* _set,
-                                      bool* _already_assigned) {
+  static void assign_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors,
+                           std::array<bool, size_>* _set) {
     using FieldType = tuple_element_t<i, typename ViewType::Fields>;
     using OriginalType = typename FieldType::Type;
     using T =
         std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
     constexpr auto name = FieldType::name();
-    if (!(*_already_assigned) && !std::get<i>(*_found) &&
-        is_matching<i, FieldType>(_current_name_or_index)) {
-      std::get<i>(*_found) = true;
-      *_already_assigned = true;
-      auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
-      if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error().what();
-        _errors->emplace_back(Error(stream.str()));
-        return;
-      }
-      if constexpr (std::is_pointer_v<OriginalType>) {
-        move_to(rfl::get<i>(*_view), &(*res));
-      } else {
-        rfl::get<i>(*_view) = std::move(*res);
-      }
-      std::get<i>(*_set) = true;
+    auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if (!res) {
+      std::stringstream stream;
+      stream << "Failed to parse field '" << std::string(name)
+             << "': " << res.error().what();
+      _errors->emplace_back(Error(stream.str()));
+      return;
+    }
+    if constexpr (std::is_pointer_v<OriginalType>) {
+      move_to(rfl::get<i>(*_view), &(*res));
+    } else {
+      rfl::get<i>(*_view) = std::move(*res);
     }
+    std::get<i>(*_set) = true;
+  }
+
+  template <int... is>
+  static constexpr std::array<AssignFieldType, size_> make_assigners(
+      std::integer_sequence<int, is...>) {
+    return std::array<AssignFieldType, size_>{&assign_field<is>...};
   }
 
   template <int _pos>
@@ -113,17 +110,19 @@ class ViewReader {
     extra_fields->emplace(std::string(_current_name), std::move(*res));
   }
 
-  template <int... is>
-  static void assign_to_matching_field(const R& _r,
+  static void assign_to_matching_field(const R& _r, const int _ix,
                                        const auto _current_name_or_index,
                                        const auto& _var, auto* _view,
-                                       auto* _errors, auto* _found, auto* _set,
-                                       std::integer_sequence<int, is...>) {
-    bool already_assigned = false;
-
-    (assign_if_field_matches<is>(_r, _current_name_or_index, _var, _view,
-                                 _errors, _found, _set, &already_assigned),
-     ...);
+                                       auto* _errors, auto* _found,
+                                       auto* _set) {
+    // A field that has already been found is treated like an unknown key, so
+    // the first occurrence of any duplicate key wins.
+    const bool already_assigned = _ix != -1 && !(*_found)[_ix];
+
+    if (already_assigned) {
+      (*_found)[_ix] = true;
+      assigners_[_ix](_r, _var, _view, _errors, _set);
+    }
 
     if constexpr (ViewType::pos_extra_fields() != -1) {
       static_assert(!schemaful::IsSchemafulReader<R>,
@@ -149,26 +148,6 @@ class ViewReader {
     }
   }
 
-  template <class Target, class Source>
-  static void move_to(Target* _t, Source* _s) {
-    if constexpr (std::is_const_v<Target>) {
-      return move_to(const_cast<std::remove_const_t<Target>*>(_t), _s);
-    } else if constexpr (!rfl::internal::is_array_v<Source> &&
-                         !std::is_array_v<Target>) {
-      ::new (_t) Target(std::move(*_s));
-    } else if constexpr (rfl::internal::is_array_v<Source>) {
-      static_assert(std::is_array_v<Target>,
-                    "Expected target to be a c-array.");
-      for (size_t i = 0; i < _s->arr_.size(); ++i) {
-        move_to(&((*_t)[i]), &(_s->arr_[i]));
-      }
-    } else {
-      for (size_t i = 0; i < _s->size(); ++i) {
-        move_to(&((*_t)[i]), &((*_s)[i]));
-      }
-    }
-  }
-
  private:
   /// The underlying reader.
   const R* r_;
@@ -185,6 +164,15 @@ class ViewReader {
 
   /// Collects any errors we may have come across.
   std::vector<Error>* errors_;
+
+  /// Maps the names of the keys to the fields of the view.
+  mutable internal::FieldIndexLookup<typename ViewType::Fields,
+                                     !ReordersKeys<R>>
+      field_lookup_;
+
+  /// Jump table used to dispatch to the parser of the matching field.
+  static constexpr auto assigners_ =
+      make_assigners(std::make_integer_sequence<int, size_>());
 };
 
 }  // namespace rfl::parsing
@@ -0,0 +1,116 @@
+#ifndef RFL_PARSING_VIEWREADERINPLACE_HPP_
+#define RFL_PARSING_VIEWREADERINPLACE_HPP_
+
+#include <array>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../Tuple.hpp"
+#include "../internal/FieldIndexLookup.hpp"
+#include "IsReader.hpp"
+#include "InPlaceParser.hpp"
+
+namespace rfl::parsing {
+
+/// Like the ViewReader, but the view points to fields that have already been
+/// constructed, which are then overwritten in place using the InPlaceParser.
+template <class R, class W, class ViewType, class ProcessorsType>
+class ViewReaderInPlace {
+ private:
+  using InputVarType = typename R::InputVarType;
+  static constexpr size_t size_ = ViewType::size();
+
+ public:
+  ViewReaderInPlace(const R* _r, ViewType* _view,
+                    std::array<bool, size_>* _found,
+                    std::vector<Error>* _errors)
+      : r_(_r), view_(_view), found_(_found), errors_(_errors) {}
+
+  ~ViewReaderInPlace() = default;
+
+  /// Assigns the parsed version of _var to the field signified by _name, if
+  /// such a field exists in the underlying view.
+  void read(const std::string_view& _name, const InputVarType& _var) const {
+    const int ix = field_lookup_.find(_name);
+    const bool already_assigned = ix != -1 && !(*found_)[ix];
+
+    if (already_assigned) {
+      (*found_)[ix] = true;
+      assigners_[ix](*r_, _var, view_, errors_);
+    }
+
+    if constexpr (ProcessorsType::no_extra_fields_) {
+      if (!already_assigned) {
+        std::stringstream stream;
+        stream << "Value named '" << std::string(_name)
+               << "' not used. Remove the rfl::NoExtraFields processor or add "
+                  "rfl::ExtraFields to avoid this error message.";
+        errors_->emplace_back(Error(stream.str()));
+      }
+    }
+  }
+
+ private:
+  using AssignFieldType = void (*)(const R&, const InputVarType&, ViewType*,
+                                   std::vector<Error>*);
+
+  template <int i>
+  static void assign_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors) {
+    using FieldType = tuple_element_t<i, typename ViewType::Fields>;
+    using OriginalType = typename FieldType::Type;
+    using T =
+        std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
+    constexpr auto name = FieldType::name();
+    std::optional<Error> err;
+    if constexpr (std::is_pointer_v<OriginalType>) {
+      err = InPlaceParser<R, W, T, ProcessorsType>::read(
+          _r, _var, const_cast<T*>(rfl::get<i>(*_view)));
+    } else {
+      err = InPlaceParser<R, W, T, ProcessorsType>::read(_r, _var,
+                                                         &rfl::get<i>(*_view));
+    }
+    if (err) {
+      std::stringstream stream;
+      stream << "Failed to parse field '" << std::string(name)
+             << "': " << err->what();
+      _errors->emplace_back(Error(stream.str()));
+    }
+  }
+
+  template <int... is>
+  static constexpr std::array<AssignFieldType, size_> make_assigners(
+      std::integer_sequence<int, is...>) {
+    return std::array<AssignFieldType, size_>{&assign_field<is>...};
+  }
+
+ private:
+  /// The underlying reader.
+  const R* r_;
+
+  /// The underlying view.
+  ViewType* view_;
+
+  /// Indicates that a certain field has been found.
+  std::array<bool, size_>* found_;
+
+  /// Collects any errors we may have come across.
+  std::vector<Error>* errors_;
+
+  /// Maps the names of the keys to the fields of the view.
+  mutable internal::FieldIndexLookup<typename ViewType::Fields,
+                                     !ReordersKeys<R>>
+      field_lookup_;
+
+  /// Jump table used to dispatch to the parser of the matching field.
+  static constexpr auto assigners_ =
+      make_assigners(std::make_integer_sequence<int, size_>());
+};
+
+}  // namespace rfl::parsing
+
+#endif
@@ -10,7 +10,10 @@
 
 #include "../Result.hpp"
 #include "../Tuple.hpp"
+#include "../internal/FieldIndexLookup.hpp"
 #include "../internal/is_array.hpp"
+#include "IsReader.hpp"
+#include "move_to.hpp"
 
 namespace rfl::parsing {
 
@@ -32,42 +35,43 @@ class ViewReaderWithDefault {
   /// Assigns the parsed version of _var to the field signified by _name, if
   /// such a field exists in the underlying view.
   void read(const std::string_view& _name, const InputVarType& _var) const {
-    assign_to_matching_field(*r_, _name, _var, view_, errors_, found_.get(),
-                             std::make_integer_sequence<int, size_>());
+    assign_to_matching_field(*r_, field_lookup_.find(_name), _name, _var,
+                             view_, errors_, found_.get());
   }
 
  private:
+  using AssignFieldType = void (*)(const R&, const InputVarType&, ViewType*,
+                                   std::vector<Error>*);
+
   template <int i>
-  static void assign_if_field_matches(const R& _r,
-                                      const std::string_view& _current_name,
-                                      const auto& _var, auto* _view,
-                                      auto* _errors, auto* _found,
-                                      bool* _already_assigned) {
+  static void assign_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors) {
     using FieldType = tuple_element_t<i, typename ViewType::Fields>;
     using OriginalType = typename FieldType::Type;
     using T =
         std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
     constexpr auto name = FieldType::name();
-    if (!(*_already_assigned) && !std::get<i>(*_found) &&
-        _current_name == name) {
-      std::get<i>(*_found) = true;
-      *_already_assigned = true;
-      auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
-      if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error().what();
-        _errors->emplace_back(Error(stream.str()));
-        return;
-      }
-      if constexpr (std::is_pointer_v<OriginalType>) {
-        move_to(rfl::get<i>(*_view), &(*res));
-      } else {
-        rfl::get<i>(*_view) = std::move(*res);
-      }
+    auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if (!res) {
+      std::stringstream stream;
+      stream << "Failed to parse field '" << std::string(name)
+             << "': " << res.error().what();
+      _errors->emplace_back(Error(stream.str()));
+      return;
+    }
+    if constexpr (std::is_pointer_v<OriginalType>) {
+      move_to</*_overwrite=*/true>(rfl::get<i>(*_view), &(*res));
+    } else {
+      rfl::get<i>(*_view) = std::move(*res);
     }
   }
 
+  template <int... is>
+  static constexpr std::array<AssignFieldType, size_> make_assigners(
+      std::integer_sequence<int, is...>) {
+    return std::array<AssignFieldType, size_>{&assign_field<is>...};
+  }
+
   template <int _pos>
   static void assign_to_extra_fields(const R& _r,
                                      const std::string_view& _current_name,
@@ -89,17 +93,16 @@ class ViewReaderWithDefault {
     extra_fields->emplace(std::string(_current_name), std::move(*res));
   }
 
-  template <int... is>
-  static void assign_to_matching_field(const R& _r,
+  static void assign_to_matching_field(const R& _r, const int _ix,
                                        const std::string_view& _current_name,
                                        const auto& _var, auto* _view,
-                                       auto* _errors, auto* _found,
-                                       std::integer_sequence<int, is...>) {
-    bool already_assigned = false;
+                                       auto* _errors, auto* _found) {
+    const bool already_assigned = _ix != -1 && !(*_found)[_ix];
 
-    (assign_if_field_matches<is>(_r, _current_name, _var, _view, _errors,
-                                 _found, &already_assigned),
-     ...);
+    if (already_assigned) {
+      (*_found)[_ix] = true;
+      assigners_[_ix](_r, _var, _view, _errors);
+    }
 
     if constexpr (ViewType::pos_extra_fields() != -1) {
       constexpr int pos = ViewType::pos_extra_fields();
@@ -117,26 +120,6 @@ class ViewReaderWithDefault {
     }
   }
 
-  template <class Target, class Source>
-  static void move_to(Target* _t, Source* _s) {
-    if constexpr (std::is_const_v<Target>) {
-      return move_to(const_cast<std::remove_const_t<Target>*>(_t), _s);
-    } else if constexpr (!rfl::internal::is_array_v<Source> &&
-                         !std::is_array_v<Target>) {
-      *_t = Target(std::move(*_s));
-    } else if constexpr (rfl::internal::is_array_v<Source>) {
-      static_assert(std::is_array_v<Target>,
-                    "Expected target to be a c-array.");
-      for (size_t i = 0; i < _s->arr_.size(); ++i) {
-        move_to(&((*_t)[i]), &(_s->arr_[i]));
-      }
-    } else {
-      for (size_t i = 0; i < _s->size(); ++i) {
-        move_to(&((*_t)[i]), &((*_s)[i]));
-      }
-    }
-  }
-
  private:
   /// The underlying reader.
   const R* r_;
@@ -149,6 +132,15 @@ class ViewReaderWithDefault {
 
   /// Collects any errors we may have come across.
   std::vector<Error>* errors_;
+
+  /// Maps the names of the keys to the fields of the view.
+  mutable internal::FieldIndexLookup<typename ViewType::Fields,
+                                     !ReordersKeys<R>>
+      field_lookup_;
+
+  /// Jump table used to dispatch to the parser of the matching field.
+  static constexpr auto assigners_ =
+      make_assigners(std::make_integer_sequence<int, size_>());
 };
 
 }  // namespace rfl::parsing
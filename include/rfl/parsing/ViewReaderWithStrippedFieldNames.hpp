@@ -11,6 +11,7 @@
 #include "../Result.hpp"
 #include "../Tuple.hpp"
 #include "../internal/is_array.hpp"
+#include "move_to.hpp"
 
 namespace rfl::parsing {
 
@@ -43,68 +44,48 @@ class ViewReaderWithStrippedFieldNames {
              << " fields, but got at least one more.";
       return Error(stream.str());
     }
-    assign_to_field_i(*r_, _var, view_, errors_, found_, set_, i_,
-                      std::make_integer_sequence<int, size_>());
+    assigners_[i_](*r_, _var, view_, errors_, found_, set_);
     ++i_;
     return std::nullopt;
   }
 
  private:
+  using AssignFieldType = void (*)(const R&, const InputVarType&, ViewType*,
+                                   std::vector<Error>*,
+                                   std::array<bool, size_>*,
+                                   std::array<bool, size_>*);
+
   template <int i>
-  static void assign_if_field_is_field_i(const R& _r, const auto& _var,
-                                         auto* _view, auto* _errors,
-                                         auto* _found, auto* _set, int _i) {
+  static void assign_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors,
+                           std::array<bool, size_>* _found,
+                           std::array<bool, size_>* _set) {
     using FieldType = tuple_element_t<i, typename ViewType::Fields>;
     using OriginalType = typename FieldType::Type;
     using T =
         std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
     constexpr auto name = FieldType::name();
-    if (_i == i) {
-      std::get<i>(*_found) = true;
-      auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
-      if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error().what();
-        _errors->emplace_back(Error(stream.str()));
-        return;
-      }
-      if constexpr (std::is_pointer_v<OriginalType>) {
-        move_to(rfl::get<i>(*_view), &(*res));
-      } else {
-        rfl::get<i>(*_view) = std::move(*res);
-      }
-      std::get<i>(*_set) = true;
+    std::get<i>(*_found) = true;
+    auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if (!res) {
+      std::stringstream stream;
+      stream << "Failed to parse field '" << std::string(name)
+             << "': " << res.error().what();
+      _errors->emplace_back(Error(stream.str()));
+      return;
     }
+    if constexpr (std::is_pointer_v<OriginalType>) {
+      move_to(rfl::get<i>(*_view), &(*res));
+    } else {
+      rfl::get<i>(*_view) = std::move(*res);
+    }
+    std::get<i>(*_set) = true;
   }
 
   template <int... is>
-  static void assign_to_field_i(const R& _r, const auto& _var, auto* _view,
-                                auto* _errors, auto* _found, auto* _set, int _i,
-                                std::integer_sequence<int, is...>) {
-    (assign_if_field_is_field_i<is>(_r, _var, _view, _errors, _found, _set, _i),
-     ...);
-  }
-
-  // TODO: Unnecessary code duplication.
-  template <class Target, class Source>
-  static void move_to(Target* _t, Source* _s) {
-    if constexpr (std::is_const_v<Target>) {
-      return move_to(const_cast<std::remove_const_t<Target>*>(_t), _s);
-    } else if constexpr (!rfl::internal::is_array_v<Source> &&
-                         !std::is_array_v<Target>) {
-      ::new (_t) Target(std::move(*_s));
-    } else if constexpr (rfl::internal::is_array_v<Source>) {
-      static_assert(std::is_array_v<Target>,
-                    "Expected target to be a c-array.");
-      for (size_t i = 0; i < _s->arr_.size(); ++i) {
-        move_to(&((*_t)[i]), &(_s->arr_[i]));
-      }
-    } else {
-      for (size_t i = 0; i < _s->size(); ++i) {
-        move_to(&((*_t)[i]), &((*_s)[i]));
-      }
-    }
+  static constexpr std::array<AssignFieldType, size_> make_assigners(
+      std::integer_sequence<int, is...>) {
+    return std::array<AssignFieldType, size_>{&assign_field<is>...};
   }
 
  private:
@@ -126,6 +107,10 @@ class ViewReaderWithStrippedFieldNames {
 
   /// Collects any errors we may have come across.
   std::vector<Error>* errors_;
+
+  /// Jump table used to dispatch to the parser of field i_.
+  static constexpr auto assigners_ =
+      make_assigners(std::make_integer_sequence<int, size_>());
 };
 
 }  // namespace rfl::parsing
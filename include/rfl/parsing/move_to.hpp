@@ -0,0 +1,43 @@
+#ifndef RFL_PARSING_MOVE_TO_HPP_
+#define RFL_PARSING_MOVE_TO_HPP_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../internal/is_array.hpp"
+
+namespace rfl::parsing {
+
+/// Moves the parsed value _s into _t. C arrays, which are parsed into an
+/// rfl::internal::Array, are moved element by element. By default, _t points
+/// to uninitialized memory and the value is constructed in place. If
+/// _overwrite is set, _t already holds a value, which is assigned to instead.
+template <bool _overwrite = false, class Target, class Source>
+void move_to(Target* _t, Source* _s) {
+  if constexpr (std::is_const_v<Target>) {
+    return move_to<_overwrite>(const_cast<std::remove_const_t<Target>*>(_t),
+                               _s);
+  } else if constexpr (!internal::is_array_v<Source> &&
+                       !std::is_array_v<Target>) {
+    if constexpr (_overwrite) {
+      *_t = Target(std::move(*_s));
+    } else {
+      ::new (_t) Target(std::move(*_s));
+    }
+  } else if constexpr (internal::is_array_v<Source>) {
+    static_assert(std::is_array_v<Target>, "Expected target to be a c-array.");
+    for (size_t i = 0; i < _s->arr_.size(); ++i) {
+      move_to<_overwrite>(&((*_t)[i]), &(_s->arr_[i]));
+    }
+  } else {
+    for (size_t i = 0; i < _s->size(); ++i) {
+      move_to<_overwrite>(&((*_t)[i]), &((*_s)[i]));
+    }
+  }
+}
+
+}  // namespace rfl::parsing
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef RFL_PARSING_READ_ARRAY_IN_PARALLEL_HPP_
+#define RFL_PARSING_READ_ARRAY_IN_PARALLEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "../Result.hpp"
+#include "IsReader.hpp"
+#include "Parser_base.hpp"
+
+namespace rfl::parsing {
+
+/// Arrays are split into chunks of at least this many elements, so that
+/// starting a thread is always worth it.
+inline constexpr size_t min_elements_per_thread = 4096;
+
+/// Whether the current thread is reading a chunk of an array in parallel.
+/// Arrays nested inside such a chunk are read sequentially, so the number of
+/// threads does not multiply.
+inline bool& is_reading_in_parallel() noexcept {
+  thread_local bool reading_in_parallel = false;
+  return reading_in_parallel;
+}
+
+/// The number of threads to use at most. This defaults to
+/// std::thread::hardware_concurrency() and can be changed, for instance to
+/// leave some cores for other work:
+///
+///   rfl::parsing::max_threads() = 4;
+inline std::atomic<size_t>& max_threads() noexcept {
+  static std::atomic<size_t> max_threads =
+      std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  return max_threads;
+}
+
+/// Whether it is worth splitting _arr across several threads.
+template <class R>
+requires SupportsParallelReading<R>
+bool should_read_in_parallel(const R& _r,
+                             const typename R::InputArrayType& _arr) noexcept {
+  return static_cast<size_t>(_r.array_size(_arr)) >=
+             2 * min_elements_per_thread &&
+         !is_reading_in_parallel() && max_threads().load() > 1;
+}
+
+/// Reads the elements of _arr into _vec, which must be empty, using up to
+/// max_threads() threads. The elements are collected
+/// first, then _vec is resized and every thread parses a contiguous chunk
+/// into its slots. If several elements cannot be parsed, the error of the
+/// first one is returned, which is the same error a sequential read would
+/// return.
+template <class R, class W, class T, class ProcessorsType>
+requires SupportsParallelReading<R>
+std::optional<Error> read_array_in_parallel(
+    const R& _r, const typename R::InputArrayType& _arr, std::vector<T>* _vec) {
+  using InputVarType = typename R::InputVarType;
+
+  struct Collector {
+    std::optional<Error> read(const InputVarType& _var) const {
+      vars_->push_back(_var);
+      return std::nullopt;
+    }
+    std::vector<InputVarType>* vars_;
+  };
+
+  std::vector<InputVarType> vars;
+  vars.reserve(static_cast<size_t>(_r.array_size(_arr)));
+  const auto err = _r.read_array(Collector{&vars}, _arr);
+  if (err) {
+    return err;
+  }
+
+  const size_t size = vars.size();
+  const size_t num_threads = std::max<size_t>(
+      std::min<size_t>(max_threads().load(), size / min_elements_per_thread),
+      1);
+
+  _vec->resize(size);
+
+  std::vector<std::optional<Error>> errors(num_threads);
+
+  /// The index of the first element known to have failed. Chunks stop once
+  /// they are past it, because their results would be discarded anyway.
+  std::atomic<size_t> first_failure = size;
+
+  const auto read_chunk = [&](const size_t _t) {
+    const bool was_reading_in_parallel = is_reading_in_parallel();
+    is_reading_in_parallel() = true;
+    const size_t end = size * (_t + 1) / num_threads;
+    for (size_t i = size * _t / num_threads; i < end; ++i) {
+      if (first_failure.load(std::memory_order_relaxed) < i) {
+        break;
+      }
+      auto res = Parser<R, W, T, ProcessorsType>::read(_r, vars[i]);
+      if (!res) {
+        errors[_t] = res.error();
+        size_t expected = first_failure.load(std::memory_order_relaxed);
+        while (i < expected && !first_failure.compare_exchange_weak(
+                                   expected, i, std::memory_order_relaxed)) {
+        }
+        break;
+      }
+      (*_vec)[i] = std::move(*res);
+    }
+    is_reading_in_parallel() = was_reading_in_parallel;
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  size_t t = 1;
+  try {
+    for (; t < num_threads; ++t) {
+      threads.emplace_back(read_chunk, t);
+    }
+  } catch (std::system_error&) {
+    // If we cannot start any more threads, the remaining chunks are read on
+    // this thread.
+  }
+
+  read_chunk(0);
+  for (; t < num_threads; ++t) {
+    read_chunk(t);
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& e : errors) {
+    if (e) {
+      return std::move(e);
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace rfl::parsing
+
+#endif
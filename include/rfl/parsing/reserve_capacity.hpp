@@ -0,0 +1,43 @@
+#ifndef RFL_PARSING_RESERVE_CAPACITY_HPP_
+#define RFL_PARSING_RESERVE_CAPACITY_HPP_
+
+#include <cstddef>
+
+#include "IsReader.hpp"
+
+namespace rfl::parsing {
+
+/// Reserves capacity for _size elements, if the container supports it. For
+/// unordered containers, this is the same as a rehash hint.
+template <class ContainerType>
+void reserve_capacity(const size_t _size, ContainerType* _container) {
+  if constexpr (requires(ContainerType c) { c.reserve(_size); }) {
+    _container->reserve(_size);
+  }
+}
+
+/// Reserves capacity for all elements in _arr, if the reader can report the
+/// size of the array.
+template <class R, class ContainerType>
+void reserve_capacity_for_array(const R& _r,
+                                const typename R::InputArrayType& _arr,
+                                ContainerType* _container) {
+  if constexpr (SupportsArraySize<R>) {
+    reserve_capacity(static_cast<size_t>(_r.array_size(_arr)), _container);
+  }
+}
+
+/// Reserves capacity for all key-value pairs in _obj, if the reader can report
+/// the size of the object.
+template <class R, class ContainerType>
+void reserve_capacity_for_object(const R& _r,
+                                 const typename R::InputObjectType& _obj,
+                                 ContainerType* _container) {
+  if constexpr (SupportsObjectSize<R>) {
+    reserve_capacity(static_cast<size_t>(_r.object_size(_obj)), _container);
+  }
+}
+
+}  // namespace rfl::parsing
+
+#endif
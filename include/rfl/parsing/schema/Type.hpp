@@ -34,6 +34,9 @@ struct Type {
 
   struct String {};
 
+  /// A point in time, see rfl::NativeTimestamps.
+  struct Timestamp {};
+
   struct AnyOf {
     std::vector<Type> types_;
   };
@@ -89,7 +92,7 @@ struct Type {
 
   using VariantType =
       rfl::Variant<Boolean, Bytestring, Int32, Int64, UInt32, UInt64, Integer,
-                   Float, Double, String, AnyOf, Description,
+                   Float, Double, String, Timestamp, AnyOf, Description,
                    FixedSizeTypedArray, Literal, Object, Optional, Reference,
                    StringMap, Tuple, TypedArray, Validated>;
 
@@ -0,0 +1,40 @@
+#ifndef RFL_PARSING_SUPPORTSSTATICNAMES_HPP_
+#define RFL_PARSING_SUPPORTSSTATICNAMES_HPP_
+
+#include <concepts>
+#include <string_view>
+
+#include "StaticName.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a writer can make use of the fact that a field name
+/// is known at compile time (see StaticName), for instance by referencing it
+/// rather than copying it.
+template <class W>
+concept supports_static_names = requires(W w, StaticName name,
+                                         std::string_view basic_value,
+                                         typename W::OutputObjectType obj,
+                                         size_t size) {
+  {
+    w.add_array_to_object(name, size, &obj)
+    } -> std::same_as<typename W::OutputArrayType>;
+
+  {
+    w.add_object_to_object(name, size, &obj)
+    } -> std::same_as<typename W::OutputObjectType>;
+
+  {
+    w.add_value_to_object(name, basic_value, &obj)
+    } -> std::same_as<typename W::OutputVarType>;
+
+  {
+    w.add_null_to_object(name, &obj)
+    } -> std::same_as<typename W::OutputVarType>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
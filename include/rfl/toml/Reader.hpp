@@ -28,6 +28,10 @@ struct Reader {
   using InputObjectType = const ::toml::table*;
   using InputVarType = const ::toml::value*;
 
+  /// toml::table is a hash map, so the keys are not visited in the order
+  /// they were written.
+  static constexpr bool reorders_keys = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_toml_obj(var); });
@@ -91,6 +95,14 @@ struct Reader {
     return &_var->as_array();
   }
 
+  size_t array_size(const InputArrayType _arr) const noexcept {
+    return _arr->size();
+  }
+
+  size_t object_size(const InputObjectType _obj) const noexcept {
+    return _obj->size();
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType _arr) const noexcept {
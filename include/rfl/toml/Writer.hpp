@@ -72,7 +72,7 @@ class Writer {
   template <class T>
   OutputVarType add_value_to_array(const T& _var,
                                    OutputArrayType* _parent) const noexcept {
-    _parent->val_->push_back(::toml::value(_var));
+    _parent->val_->push_back(to_value(_var));
     return OutputVarType{};
   }
 
@@ -80,7 +80,7 @@ class Writer {
   OutputVarType add_value_to_object(const std::string_view& _name,
                                     const T& _var,
                                     OutputObjectType* _parent) const noexcept {
-    (*_parent->val_)[std::string(_name)] = ::toml::value(_var);
+    (*_parent->val_)[std::string(_name)] = to_value(_var);
     return OutputVarType{};
   }
 
@@ -94,6 +94,18 @@ class Writer {
   void end_object(OutputObjectType* _obj) const noexcept;
 
  private:
+  /// toml++ stores strings as std::string, so a std::string_view is copied
+  /// into one here instead of relying on the deduction guides of
+  /// ::toml::value.
+  template <class T>
+  static auto to_value(const T& _var) noexcept {
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      return ::toml::value<std::string>(std::string(_var));
+    } else {
+      return ::toml::value(_var);
+    }
+  }
+
   ::toml::table* root_;
 };
 
@@ -12,6 +12,7 @@
 
 #include "../Processors.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -56,6 +57,37 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(toml_str);
 }
 
+/// Parses a TOML var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, InputVarType _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for BSON, XML, "
+                "TOML, or YAML.");
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses TOML into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::string& _toml_str) {
+  auto res = ::toml::try_parse_str(_toml_str);
+  if (res.is_ok()) {
+    return read_into<Ps...>(_target, &res.unwrap());
+  } else {
+    return error(::toml::format_error(res.unwrap_err().at(0)));
+  }
+}
+
 }  // namespace rfl::toml
 
 #endif
@@ -9,6 +9,7 @@
 #include "../Processors.hpp"
 #include "../internal/get_type_name.hpp"
 #include "../internal/remove_namespaces.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -49,6 +50,38 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(xml_str);
 }
 
+/// Parses a XML var into an existing object, reusing the storage of its
+/// strings, vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const InputVarType& _var) {
+  using T = std::remove_cvref_t<decltype(_target)>;
+  using ProcessorsType = Processors<Ps...>;
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for BSON, XML, "
+                "TOML, or YAML.");
+  const auto r = Reader();
+  const auto err =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>::read(
+          r, _var, &_target);
+  if (err) {
+    return error(*err);
+  }
+  return Nothing{};
+}
+
+/// Parses XML into an existing object, reusing the storage of its strings,
+/// vectors and nested structs wherever possible.
+template <class... Ps>
+Result<Nothing> read_into(auto& _target, const std::string_view _xml_str) {
+  pugi::xml_document doc;
+  const auto result = doc.load_string(_xml_str.data());
+  if (!result) {
+    return error("XML string could not be parsed: " +
+                 std::string(result.description()));
+  }
+  return read_into<Ps...>(_target, InputVarType(doc.first_child()));
+}
+
 }  // namespace xml
 }  // namespace rfl
 
@@ -17,6 +17,7 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "../parsing/NodeKind.hpp"
 
 namespace rfl {
 namespace yaml {
@@ -69,6 +70,18 @@ struct Reader {
     return !_var.node_ && true;
   }
 
+  /// Scalars are reported as NodeKind::unknown, because YAML does not
+  /// distinguish between strings, numbers and booleans.
+  parsing::NodeKind node_kind(const InputVarType& _var) const noexcept {
+    if (_var.node_.IsMap()) {
+      return parsing::NodeKind::object;
+    } else if (_var.node_.IsSequence()) {
+      return parsing::NodeKind::array;
+    } else {
+      return parsing::NodeKind::unknown;
+    }
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     try {
@@ -97,6 +110,14 @@ struct Reader {
     return InputArrayType(_var.node_);
   }
 
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.node_.size();
+  }
+
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.node_.size();
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
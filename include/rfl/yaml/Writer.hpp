@@ -91,6 +91,10 @@ class Writer {
                   std::is_same<std::remove_cvref_t<T>,
                                std::remove_cvref_t<decltype(YAML::Null)>>()) {
       (*out_) << YAML::Key << _name.data() << YAML::Value << _var;
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      // YAML::Emitter only accepts std::string.
+      (*out_) << YAML::Key << _name.data() << YAML::Value << std::string(_var);
     } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
       // std::to_string is necessary to ensure that floating point values are
       // always written as floats.
@@ -112,6 +116,9 @@ class Writer {
                   std::is_same<std::remove_cvref_t<T>,
                                std::remove_cvref_t<decltype(YAML::Null)>>()) {
       (*out_) << _var;
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      (*out_) << std::string(_var);
     } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
       // std::to_string is necessary to ensure that floating point values are
       // always written as floats.
@@ -30,3 +30,4 @@ SOFTWARE.
 // compilation.
 
 #include "rfl/msgpack/Writer.cpp"
+#include "rfl/msgpack/StreamSink.cpp"
@@ -74,6 +74,9 @@ schema::Type type_to_avro_schema_type(
     } else if constexpr (std::is_same<T, Type::String>()) {
       return schema::Type{.value = schema::Type::String{}};
 
+    } else if constexpr (std::is_same<T, Type::Timestamp>()) {
+      return schema::Type{.value = schema::Type::TimestampMillis{}};
+
     } else if constexpr (std::is_same<T, Type::AnyOf>()) {
       auto any_of = std::vector<schema::Type>();
       for (const auto& t : _t.types_) {
@@ -157,7 +157,8 @@ schema::Type type_to_capnproto_schema_type(
                          std::is_same<T, Type::Integer>()) {
       return schema::Type{.value = schema::Type::Int32{}};
 
-    } else if constexpr (std::is_same<T, Type::Int64>()) {
+    } else if constexpr (std::is_same<T, Type::Int64>() ||
+                         std::is_same<T, Type::Timestamp>()) {
       return schema::Type{.value = schema::Type::Int64{}};
 
     } else if constexpr (std::is_same<T, Type::UInt32>()) {
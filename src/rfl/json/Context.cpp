@@ -0,0 +1,56 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/json/Context.hpp"
+
+#include <utility>
+
+namespace rfl::json {
+
+Context::Context() : alc_(yyjson_alc_dyn_new()) {}
+
+Context::Context(Context&& _other) noexcept
+    : alc_(std::exchange(_other.alc_, nullptr)),
+      buffer_(std::move(_other.buffer_)) {}
+
+Context::~Context() {
+  if (alc_) {
+    yyjson_alc_dyn_free(alc_);
+  }
+}
+
+Context& Context::operator=(Context&& _other) noexcept {
+  if (this != &_other) {
+    if (alc_) {
+      yyjson_alc_dyn_free(alc_);
+    }
+    alc_ = std::exchange(_other.alc_, nullptr);
+    buffer_ = std::move(_other.buffer_);
+  }
+  return *this;
+}
+
+}  // namespace rfl::json
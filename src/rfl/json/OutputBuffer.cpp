@@ -0,0 +1,97 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/json/OutputBuffer.hpp"
+
+#include <algorithm>
+
+namespace rfl::json {
+
+OutputBuffer::OutputBuffer(std::string* _str)
+    : str_(_str),
+      stream_(nullptr),
+      flushed_(0),
+      data_(_str->data()),
+      size_(_str->size()),
+      capacity_(_str->size()) {}
+
+OutputBuffer::OutputBuffer(std::span<char> _buf)
+    : str_(nullptr),
+      stream_(nullptr),
+      flushed_(0),
+      data_(_buf.data()),
+      size_(0),
+      capacity_(_buf.size()) {}
+
+OutputBuffer::OutputBuffer(std::ostream* _stream)
+    : str_(nullptr),
+      stream_(_stream),
+      chunk_(std::make_unique<char[]>(chunk_size_)),
+      flushed_(0),
+      data_(chunk_.get()),
+      size_(0),
+      capacity_(chunk_size_) {}
+
+size_t OutputBuffer::finish() {
+  if (str_) {
+    str_->resize(size_);
+  } else if (stream_) {
+    flush();
+  }
+  return flushed_ + size_;
+}
+
+void OutputBuffer::flush() {
+  stream_->write(data_, static_cast<std::streamsize>(size_));
+  flushed_ += size_;
+  size_ = 0;
+}
+
+bool OutputBuffer::grow(const size_t _additional) {
+  if (stream_) {
+    flush();
+    // Strings that are larger than the chunk are rare enough to simply
+    // enlarge the chunk.
+    if (_additional > capacity_) {
+      chunk_ = std::make_unique<char[]>(_additional);
+      data_ = chunk_.get();
+      capacity_ = _additional;
+    }
+    return true;
+  }
+  if (!str_) {
+    return false;
+  }
+  // The string's reserved capacity is reused by resize(...) without
+  // reallocating, but everything we resize to is zero-filled, so we only
+  // grow geometrically, instead of claiming the entire capacity at once.
+  str_->resize(std::max({2 * capacity_, size_ + _additional, min_growth_}));
+  data_ = str_->data();
+  capacity_ = str_->size();
+  return true;
+}
+
+}  // namespace rfl::json
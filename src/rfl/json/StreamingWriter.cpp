@@ -0,0 +1,337 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/json/StreamingWriter.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace rfl::json {
+
+namespace {
+
+/// For every byte, the character following the backslash in its escape
+/// sequence, 'u' if it must be written as \u00XX, 'U' if it is the start of a
+/// UTF-8 sequence to be written as \uXXXX or 0 if it can be copied as is.
+constexpr std::array<char, 256> make_escape_table(const bool _escape_unicode,
+                                                  const bool _escape_slashes) {
+  std::array<char, 256> table{};
+  for (int c = 0; c < 0x20; ++c) {
+    table[c] = 'u';
+  }
+  table['\b'] = 'b';
+  table['\t'] = 't';
+  table['\n'] = 'n';
+  table['\f'] = 'f';
+  table['\r'] = 'r';
+  table['"'] = '"';
+  table['\\'] = '\\';
+  if (_escape_slashes) {
+    table['/'] = '/';
+  }
+  if (_escape_unicode) {
+    for (int c = 0x80; c < 0x100; ++c) {
+      table[c] = 'U';
+    }
+  }
+  return table;
+}
+
+/// The escape tables for all combinations of YYJSON_WRITE_ESCAPE_UNICODE and
+/// YYJSON_WRITE_ESCAPE_SLASHES.
+constexpr std::array<std::array<char, 256>, 4> escape_tables = {
+    make_escape_table(false, false), make_escape_table(false, true),
+    make_escape_table(true, false), make_escape_table(true, true)};
+
+constexpr char hex_digits[] = "0123456789ABCDEF";
+
+void append_unicode_escape(const unsigned int _code, OutputBuffer* _buffer) {
+  const char esc[] = {'\\',
+                      'u',
+                      hex_digits[(_code >> 12) & 0xF],
+                      hex_digits[(_code >> 8) & 0xF],
+                      hex_digits[(_code >> 4) & 0xF],
+                      hex_digits[_code & 0xF]};
+  _buffer->append(esc, sizeof(esc));
+}
+
+/// Decodes the UTF-8 sequence starting at _str[_i] and writes it as one or two
+/// \uXXXX escapes. Returns the number of bytes consumed. Invalid sequences are
+/// copied byte by byte.
+size_t append_utf8_as_escapes(const std::string_view _str, const size_t _i,
+                              OutputBuffer* _buffer) {
+  const auto byte = [&](const size_t _j) {
+    return static_cast<unsigned char>(_str[_j]);
+  };
+  const auto c = byte(_i);
+  const size_t len = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+  if (len == 1 || _i + len > _str.size()) {
+    _buffer->push_back(_str[_i]);
+    return 1;
+  }
+  unsigned int code = c & (0x7F >> len);
+  for (size_t j = 1; j < len; ++j) {
+    if ((byte(_i + j) & 0xC0) != 0x80) {
+      _buffer->push_back(_str[_i]);
+      return 1;
+    }
+    code = (code << 6) | (byte(_i + j) & 0x3F);
+  }
+  if (code >= 0x10000) {
+    code -= 0x10000;
+    append_unicode_escape(0xD800 + (code >> 10), _buffer);
+    append_unicode_escape(0xDC00 + (code & 0x3FF), _buffer);
+  } else {
+    append_unicode_escape(code, _buffer);
+  }
+  return len;
+}
+
+}  // namespace
+
+StreamingWriter::StreamingWriter(OutputBuffer* _buffer,
+                                 const yyjson_write_flag _flag)
+    : buffer_(_buffer),
+      indent_((_flag & YYJSON_WRITE_PRETTY_TWO_SPACES) ? 2
+              : (_flag & YYJSON_WRITE_PRETTY)          ? 4
+                                                       : 0),
+      escape_table_(
+          escape_tables[((_flag & YYJSON_WRITE_ESCAPE_UNICODE) ? 2 : 0) +
+                        ((_flag & YYJSON_WRITE_ESCAPE_SLASHES) ? 1 : 0)]
+              .data()),
+      allow_inf_and_nan_(_flag & YYJSON_WRITE_ALLOW_INF_AND_NAN) {}
+
+StreamingWriter::OutputArrayType StreamingWriter::array_as_root(
+    const size_t) const noexcept {
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = 0};
+}
+
+StreamingWriter::OutputObjectType StreamingWriter::object_as_root(
+    const size_t) const noexcept {
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = 0};
+}
+
+StreamingWriter::OutputVarType StreamingWriter::null_as_root() const noexcept {
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+StreamingWriter::OutputArrayType StreamingWriter::add_array_to_array(
+    const size_t, OutputArrayType* _parent) const noexcept {
+  begin_element(_parent);
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = _parent->depth_ + 1};
+}
+
+StreamingWriter::OutputArrayType StreamingWriter::add_array_to_object(
+    const std::string_view& _name, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  begin_field(_name, _parent);
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = _parent->depth_ + 1};
+}
+
+StreamingWriter::OutputObjectType StreamingWriter::add_object_to_array(
+    const size_t, OutputArrayType* _parent) const noexcept {
+  begin_element(_parent);
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = _parent->depth_ + 1};
+}
+
+StreamingWriter::OutputObjectType StreamingWriter::add_object_to_object(
+    const std::string_view& _name, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  begin_field(_name, _parent);
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = _parent->depth_ + 1};
+}
+
+StreamingWriter::OutputVarType StreamingWriter::add_null_to_array(
+    OutputArrayType* _parent) const noexcept {
+  begin_element(_parent);
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+StreamingWriter::OutputVarType StreamingWriter::add_null_to_object(
+    const std::string_view& _name, OutputObjectType* _parent) const noexcept {
+  begin_field(_name, _parent);
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+void StreamingWriter::end_array(OutputArrayType* _arr) const noexcept {
+  end_container(_arr->depth_, _arr->empty_, ']');
+}
+
+void StreamingWriter::end_object(OutputObjectType* _obj) const noexcept {
+  end_container(_obj->depth_, _obj->empty_, '}');
+}
+
+void StreamingWriter::begin_element(OutputArrayType* _parent) const noexcept {
+  if (!_parent->empty_) {
+    buffer_->push_back(',');
+  }
+  _parent->empty_ = false;
+  write_indent(_parent->depth_ + 1);
+}
+
+void StreamingWriter::begin_field(const std::string_view& _name,
+                                  OutputObjectType* _parent) const noexcept {
+  if (!_parent->empty_) {
+    buffer_->push_back(',');
+  }
+  _parent->empty_ = false;
+  write_indent(_parent->depth_ + 1);
+  write_string(_name);
+  if (indent_ != 0) {
+    buffer_->append(": ");
+  } else {
+    buffer_->push_back(':');
+  }
+}
+
+void StreamingWriter::end_container(const size_t _depth, const bool _empty,
+                                    const char _close) const noexcept {
+  if (!_empty) {
+    write_indent(_depth);
+  }
+  buffer_->push_back(_close);
+}
+
+void StreamingWriter::write_indent(const size_t _depth) const noexcept {
+  if (indent_ != 0) {
+    buffer_->push_back('\n');
+    buffer_->append(_depth * indent_, ' ');
+  }
+}
+
+void StreamingWriter::write_string(const std::string_view _str) const noexcept {
+  buffer_->push_back('"');
+  size_t begin = 0;
+  size_t i = 0;
+  while (i < _str.size()) {
+    const auto c = static_cast<unsigned char>(_str[i]);
+    const char esc = escape_table_[c];
+    if (!esc) [[likely]] {
+      ++i;
+      continue;
+    }
+    buffer_->append(_str.data() + begin, i - begin);
+    if (esc == 'U') {
+      i += append_utf8_as_escapes(_str, i, buffer_);
+    } else if (esc == 'u') {
+      append_unicode_escape(c, buffer_);
+      ++i;
+    } else {
+      const char seq[] = {'\\', esc};
+      buffer_->append(seq, 2);
+      ++i;
+    }
+    begin = i;
+  }
+  buffer_->append(_str.data() + begin, _str.size() - begin);
+  buffer_->push_back('"');
+}
+
+void StreamingWriter::write_double(const double _val) const noexcept {
+  if (!std::isfinite(_val)) {
+    if (!allow_inf_and_nan_) {
+      buffer_->append("null");
+    } else if (std::isnan(_val)) {
+      buffer_->append("NaN");
+    } else {
+      buffer_->append(_val < 0.0 ? "-Infinity" : "Infinity");
+    }
+    return;
+  }
+  if (_val == 0.0) {
+    buffer_->append(std::signbit(_val) ? "-0.0" : "0.0");
+    return;
+  }
+
+  // std::to_chars yields the shortest representation that round-trips, just
+  // like yyjson. But we format it the way yyjson does, so the output is the
+  // same regardless of the writer: Plain decimal notation, when the decimal
+  // point is within 21 digits left or 6 digits right of the first digit,
+  // otherwise scientific notation without a '+' or leading zeros in the
+  // exponent. Subnormal numbers are always written in scientific notation.
+  char buf[32];
+  const auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), _val,
+                                       std::chars_format::scientific);
+  const auto str = std::string_view(buf, ptr - buf);
+  const auto e = str.find('e');
+
+  if (str.front() == '-') {
+    buffer_->push_back('-');
+  }
+
+  char digits[20];
+  size_t num_digits = 0;
+  for (const char c : str.substr(0, e)) {
+    if (c >= '0' && c <= '9') {
+      digits[num_digits++] = c;
+    }
+  }
+
+  int exp = 0;
+  std::from_chars(str.data() + e + (str[e + 1] == '+' ? 2 : 1),
+                  str.data() + str.size(), exp);
+
+  const int dot_pos = exp + 1;
+
+  if (-6 < dot_pos && dot_pos <= 21 &&
+      std::fabs(_val) >= std::numeric_limits<double>::min()) {
+    if (dot_pos <= 0) {
+      buffer_->append("0.");
+      buffer_->append(static_cast<size_t>(-dot_pos), '0');
+      buffer_->append(digits, num_digits);
+    } else if (num_digits <= static_cast<size_t>(dot_pos)) {
+      buffer_->append(digits, num_digits);
+      buffer_->append(dot_pos - num_digits, '0');
+      buffer_->append(".0");
+    } else {
+      buffer_->append(digits, dot_pos);
+      buffer_->push_back('.');
+      buffer_->append(digits + dot_pos, num_digits - dot_pos);
+    }
+  } else {
+    buffer_->push_back(digits[0]);
+    if (num_digits > 1) {
+      buffer_->push_back('.');
+      buffer_->append(digits + 1, num_digits - 1);
+    }
+    buffer_->push_back('e');
+    const auto [exp_ptr, exp_ec] =
+        std::to_chars(buf, buf + sizeof(buf), exp);
+    buffer_->append(buf, exp_ptr - buf);
+  }
+}
+
+}  // namespace rfl::json
@@ -59,7 +59,15 @@ Writer::OutputArrayType Writer::add_array_to_object(
     const std::string_view& _name, const size_t,
     OutputObjectType* _parent) const noexcept {
   const auto arr = yyjson_mut_arr(doc_);
-  yyjson_mut_obj_add(_parent->val_, yyjson_mut_strcpy(doc_, _name.data()), arr);
+  yyjson_mut_obj_add(_parent->val_, copy_key(_name), arr);
+  return OutputArrayType(arr);
+}
+
+Writer::OutputArrayType Writer::add_array_to_object(
+    const parsing::StaticName& _name, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  const auto arr = yyjson_mut_arr(doc_);
+  yyjson_mut_obj_add(_parent->val_, reference_key(_name), arr);
   return OutputArrayType(arr);
 }
 
@@ -74,7 +82,15 @@ Writer::OutputObjectType Writer::add_object_to_object(
     const std::string_view& _name, const size_t,
     OutputObjectType* _parent) const noexcept {
   const auto obj = yyjson_mut_obj(doc_);
-  yyjson_mut_obj_add(_parent->val_, yyjson_mut_strcpy(doc_, _name.data()), obj);
+  yyjson_mut_obj_add(_parent->val_, copy_key(_name), obj);
+  return OutputObjectType(obj);
+}
+
+Writer::OutputObjectType Writer::add_object_to_object(
+    const parsing::StaticName& _name, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  const auto obj = yyjson_mut_obj(doc_);
+  yyjson_mut_obj_add(_parent->val_, reference_key(_name), obj);
   return OutputObjectType(obj);
 }
 
@@ -88,8 +104,14 @@ Writer::OutputVarType Writer::add_null_to_array(
 Writer::OutputVarType Writer::add_null_to_object(
     const std::string_view& _name, OutputObjectType* _parent) const noexcept {
   const auto null = yyjson_mut_null(doc_);
-  yyjson_mut_obj_add(_parent->val_, yyjson_mut_strcpy(doc_, _name.data()),
-                     null);
+  yyjson_mut_obj_add(_parent->val_, copy_key(_name), null);
+  return OutputVarType(null);
+}
+
+Writer::OutputVarType Writer::add_null_to_object(
+    const parsing::StaticName& _name, OutputObjectType* _parent) const noexcept {
+  const auto null = yyjson_mut_null(doc_);
+  yyjson_mut_obj_add(_parent->val_, reference_key(_name), null);
   return OutputVarType(null);
 }
 
@@ -188,7 +188,8 @@ schema::Type type_to_json_schema_type(const parsing::schema::Type& _type,
                          std::is_same<T, Type::Int64>() ||
                          std::is_same<T, Type::UInt32>() ||
                          std::is_same<T, Type::UInt64>() ||
-                         std::is_same<T, Type::Integer>()) {
+                         std::is_same<T, Type::Integer>() ||
+                         std::is_same<T, Type::Timestamp>()) {
       return schema::Type{.value = schema::Type::Integer{}};
 
     } else if constexpr (std::is_same<T, Type::Float>() ||
@@ -0,0 +1,58 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/msgpack/StreamSink.hpp"
+
+#include <cstring>
+
+namespace rfl::msgpack {
+
+int StreamSink::write(void* _sink, const char* _buf, size_t _len) {
+  auto sink = static_cast<StreamSink*>(_sink);
+  sink->append(_buf, _len);
+  return sink->stream_->good() ? 0 : -1;
+}
+
+void StreamSink::flush() {
+  if (size_ > 0) {
+    stream_->write(buf_.data(), static_cast<std::streamsize>(size_));
+    size_ = 0;
+  }
+}
+
+void StreamSink::append(const char* _buf, const size_t _len) {
+  if (size_ + _len > buf_.size()) {
+    flush();
+    if (_len >= buf_.size()) {
+      stream_->write(_buf, static_cast<std::streamsize>(_len));
+      return;
+    }
+  }
+  std::memcpy(buf_.data() + size_, _buf, _len);
+  size_ += _len;
+}
+
+}  // namespace rfl::msgpack
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/avro.hpp>
+#include <string>
+#include <vector>
+
+#include "../shared/native_timestamps.hpp"
+
+namespace test_native_timestamps {
+
+struct Avro {
+  template <class... Ps>
+  static auto write(const Event& _event) {
+    return rfl::avro::write<Ps...>(_event);
+  }
+
+  template <class T, class... Ps>
+  static auto read(const std::vector<char>& _bytes) {
+    return rfl::avro::read<T, Ps...>(_bytes);
+  }
+};
+
+TEST(avro, test_native_timestamps) {
+  // timestamp-millis holds the milliseconds since the epoch. Avro has no
+  // types in the bytes, so reading them without the processor is not
+  // guaranteed to fail. The schemas are compared below instead.
+  for (const auto& time : times()) {
+    expect_round_trip<Avro>(time, false);
+  }
+}
+
+TEST(avro, test_native_timestamps_schema) {
+  // The schema decides how the bytes are read, so it must differ, too.
+  const auto native =
+      rfl::avro::to_schema<Event, rfl::NativeTimestamps>().json_str();
+  EXPECT_NE(native.find("\"timestamp-millis\""), std::string::npos) << native;
+
+  const auto str = rfl::avro::to_schema<Event>().json_str();
+  EXPECT_EQ(str.find("timestamp-millis"), std::string::npos) << str;
+}
+
+}  // namespace test_native_timestamps
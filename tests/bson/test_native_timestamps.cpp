@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/bson.hpp>
+#include <string>
+#include <vector>
+
+#include "../shared/native_timestamps.hpp"
+
+namespace test_native_timestamps {
+
+struct Bson {
+  template <class... Ps>
+  static auto write(const Event& _event) {
+    return rfl::bson::write<Ps...>(_event);
+  }
+
+  template <class T, class... Ps>
+  static auto read(const std::vector<char>& _bytes) {
+    return rfl::bson::read<T, Ps...>(_bytes);
+  }
+};
+
+TEST(bson, test_native_timestamps) {
+  // UTC datetimes hold the milliseconds since the epoch.
+  for (const auto& time : times()) {
+    expect_round_trip<Bson>(time, true);
+  }
+}
+
+}  // namespace test_native_timestamps
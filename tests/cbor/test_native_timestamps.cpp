@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/cbor.hpp>
+#include <string>
+#include <vector>
+
+#include "../shared/native_timestamps.hpp"
+
+namespace test_native_timestamps {
+
+struct Cbor {
+  template <class... Ps>
+  static auto write(const Event& _event) {
+    return rfl::cbor::write<Ps...>(_event);
+  }
+
+  template <class T, class... Ps>
+  static auto read(const std::vector<char>& _bytes) {
+    return rfl::cbor::read<T, Ps...>(_bytes);
+  }
+};
+
+TEST(cbor, test_native_timestamps) {
+  // Tag 1 holds the seconds since the epoch.
+  for (const auto& time : times()) {
+    expect_round_trip<Cbor>(time, true);
+  }
+}
+
+}  // namespace test_native_timestamps
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_array_reader {
+
+struct Record {
+  std::string text;
+  int id;
+};
+
+/// Collects what the reader yields from _json_str, both from a buffer and
+/// from a stream, and makes sure the two agree.
+std::vector<rfl::Result<Record>> read_all(const std::string& _json_str) {
+  auto from_buffer = std::vector<rfl::Result<Record>>();
+  for (const auto& res : rfl::json::ArrayReader<Record>(_json_str)) {
+    from_buffer.push_back(res);
+  }
+
+  auto stream = std::istringstream(_json_str);
+  auto from_stream = std::vector<rfl::Result<Record>>();
+  for (const auto& res : rfl::json::ArrayReader<Record>(stream)) {
+    from_stream.push_back(res);
+  }
+
+  EXPECT_EQ(from_buffer.size(), from_stream.size());
+  for (size_t i = 0; i < std::min(from_buffer.size(), from_stream.size());
+       ++i) {
+    EXPECT_EQ(static_cast<bool>(from_buffer[i]),
+              static_cast<bool>(from_stream[i]));
+    if (from_buffer[i] && from_stream[i]) {
+      EXPECT_EQ(from_buffer[i]->text, from_stream[i]->text);
+      EXPECT_EQ(from_buffer[i]->id, from_stream[i]->id);
+    } else if (!from_buffer[i] && !from_stream[i]) {
+      EXPECT_EQ(from_buffer[i].error().what(), from_stream[i].error().what());
+    }
+  }
+  return from_buffer;
+}
+
+TEST(json, test_array_reader) {
+  auto records = std::vector<Record>();
+  for (int i = 0; i < 100; ++i) {
+    records.push_back(Record{.text = "record " + std::to_string(i), .id = i});
+  }
+  const auto results = read_all(rfl::json::write(records));
+  ASSERT_EQ(results.size(), records.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    ASSERT_TRUE(results[i]) << results[i].error().what();
+    EXPECT_EQ(results[i]->text, records[i].text);
+    EXPECT_EQ(results[i]->id, records[i].id);
+  }
+
+  EXPECT_TRUE(read_all("[]").empty());
+  EXPECT_TRUE(read_all(" \n[ \t] \r\n").empty());
+}
+
+TEST(json, test_array_reader_chunk_boundaries) {
+  // The stream is read in chunks of 64 KiB. Elements of many different sizes
+  // make sure they end at all kinds of positions within a chunk, and some
+  // elements are larger than a chunk.
+  auto records = std::vector<Record>();
+  for (int i = 0; i < 400; ++i) {
+    const auto size = (i % 10 == 9) ? 70000 + i : 37 * i % 1500;
+    records.push_back(Record{.text = std::string(size, 'a' + i % 26), .id = i});
+  }
+  const auto json_str = rfl::json::write(records, rfl::json::pretty);
+  ASSERT_GT(json_str.size(), size_t(4 * 65536));
+
+  const auto results = read_all(json_str);
+  ASSERT_EQ(results.size(), records.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    ASSERT_TRUE(results[i]) << results[i].error().what();
+    EXPECT_EQ(results[i]->text, records[i].text);
+    EXPECT_EQ(results[i]->id, records[i].id);
+  }
+}
+
+TEST(json, test_array_reader_special_characters) {
+  // Quotes, brackets and braces inside of strings must not end the element.
+  const auto texts = std::vector<std::string>{
+      "\"", "]", "[", "}", "{", ",", "\\", "\\\"]},[{", "\"]\"}", "\\\\\""};
+  auto records = std::vector<Record>();
+  for (size_t i = 0; i < texts.size(); ++i) {
+    records.push_back(Record{.text = texts[i], .id = static_cast<int>(i)});
+  }
+  const auto results = read_all(rfl::json::write(records));
+  ASSERT_EQ(results.size(), records.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    ASSERT_TRUE(results[i]) << results[i].error().what();
+    EXPECT_EQ(results[i]->text, texts[i]);
+  }
+}
+
+TEST(json, test_array_reader_errors) {
+  // A broken element is reported with its index, the others are still read.
+  const auto broken =
+      read_all(R"([{"text":"a","id":1},{"text":"b"},{"text":"c","id":3}])");
+  ASSERT_EQ(broken.size(), 3u);
+  EXPECT_TRUE(broken[0]);
+  ASSERT_FALSE(broken[1]);
+  EXPECT_EQ(broken[1].error().what().rfind("Element 1: ", 0), 0u)
+      << broken[1].error().what();
+  EXPECT_TRUE(broken[2]);
+
+  for (const auto truncated :
+       {R"([{"text":"a","id":1},)", R"([{"text":"a","id":1})",
+        R"([{"text":"a","id)", R"([)", R"([{"text":"a]})"}) {
+    const auto results = read_all(truncated);
+    ASSERT_FALSE(results.empty()) << truncated;
+    ASSERT_FALSE(results.back()) << truncated;
+    EXPECT_EQ(results.back().error().what(), "Unexpected end of input.")
+        << truncated;
+  }
+
+  EXPECT_EQ(read_all("").back().error().what(), "Expected a JSON array.");
+  EXPECT_EQ(read_all(R"({"text":"a","id":1})").back().error().what(),
+            "Expected a JSON array.");
+}
+
+TEST(json, test_array_reader_trailing_content) {
+  // Like json::read<std::vector<T>>, anything but whitespace after the
+  // array is an error.
+  for (const auto json_str :
+       {R"([{"text":"a","id":1}] trailing)", R"([{"text":"a","id":1}]])",
+        R"([{"text":"a","id":1}][])", R"([] x)"}) {
+    EXPECT_FALSE(rfl::json::read<std::vector<Record>>(json_str)) << json_str;
+    const auto results = read_all(json_str);
+    ASSERT_FALSE(results.empty()) << json_str;
+    ASSERT_FALSE(results.back()) << json_str;
+    EXPECT_EQ(results.back().error().what(),
+              "Unexpected content after the end of the array.")
+        << json_str;
+  }
+
+  const auto results = read_all(R"([{"text":"a","id":1}]  )"
+                                "\r\n\t");
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_TRUE(results[0]);
+}
+
+}  // namespace test_array_reader
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+namespace test_context {
+
+struct Measurement {
+  std::string unit;
+  double value;
+};
+
+TEST(json, test_context) {
+  auto ctx = rfl::json::Context();
+  const auto m = Measurement{.unit = "m/s", .value = 2.5};
+  const auto json_str = std::string(rfl::json::write(m, ctx));
+  EXPECT_EQ(json_str, rfl::json::write(m));
+
+  const auto res = rfl::json::read<Measurement>(json_str, ctx);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(res->unit, "m/s");
+  EXPECT_EQ(res->value, 2.5);
+}
+
+TEST(json, test_context_inf_and_nan) {
+  // write(_obj) fails on NaN, write(_obj, _ctx) writes null instead.
+  auto ctx = rfl::json::Context();
+  const auto m = Measurement{.unit = "m/s",
+                             .value = std::numeric_limits<double>::quiet_NaN()};
+  EXPECT_ANY_THROW(rfl::json::write(m));
+  EXPECT_EQ(rfl::json::write(m, ctx), R"({"unit":"m/s","value":null})");
+  EXPECT_EQ(rfl::json::write(m, ctx, YYJSON_WRITE_ALLOW_INF_AND_NAN),
+            R"({"unit":"m/s","value":NaN})");
+  EXPECT_EQ(rfl::json::write(m, YYJSON_WRITE_ALLOW_INF_AND_NAN),
+            R"({"unit":"m/s","value":NaN})");
+}
+
+TEST(json, test_context_invalid_utf8) {
+  // write(_obj) fails on invalid UTF-8, write(_obj, _ctx) copies it as is.
+  auto ctx = rfl::json::Context();
+  const auto m = Measurement{.unit = "\xff", .value = 1.0};
+  EXPECT_ANY_THROW(rfl::json::write(m));
+  EXPECT_EQ(rfl::json::write(m, ctx), "{\"unit\":\"\xff\",\"value\":1.0}");
+}
+
+}  // namespace test_context
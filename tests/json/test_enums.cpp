@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+namespace test_enums {
+
+enum class Color { red, green, blue, yellow };
+
+/// The values are too far apart for a direct lookup. Only values from 0 to
+/// 127 are given names.
+enum class Sparse : int { low = 0, mid = 60, high = 127 };
+
+enum class Permission { read = 1, write = 2, execute = 4 };
+
+Permission operator|(const Permission _p1, const Permission _p2) {
+  return static_cast<Permission>(static_cast<int>(_p1) |
+                                 static_cast<int>(_p2));
+}
+
+TEST(json, test_enums) {
+  for (const auto c : {Color::red, Color::green, Color::blue, Color::yellow}) {
+    const auto str = rfl::enum_to_string(c);
+    EXPECT_EQ(rfl::string_to_enum<Color>(str).value(), c) << str;
+  }
+  EXPECT_EQ(rfl::enum_to_string(Color::blue), "blue");
+
+  EXPECT_EQ(rfl::enum_to_string(Sparse::low), "low");
+  EXPECT_EQ(rfl::enum_to_string(Sparse::high), "high");
+  EXPECT_EQ(rfl::string_to_enum<Sparse>("mid").value(), Sparse::mid);
+
+  // Values without a name are written as integers and read back from them.
+  EXPECT_EQ(rfl::enum_to_string(static_cast<Color>(17)), "17");
+  EXPECT_EQ(rfl::enum_to_string(static_cast<Sparse>(-7)), "-7");
+  EXPECT_EQ(rfl::enum_to_string(static_cast<Sparse>(61)), "61");
+  EXPECT_EQ(rfl::string_to_enum<Color>("17").value(), static_cast<Color>(17));
+  EXPECT_EQ(rfl::string_to_enum<Sparse>("-7").value(), static_cast<Sparse>(-7));
+  EXPECT_EQ(rfl::string_to_enum<Color>("2").value(), Color::blue);
+}
+
+TEST(json, test_enums_rejected) {
+  for (const auto str : {"3x", "x3", "", " 1", "1 ", "+1", "Red", "re", "redd",
+                         "0x1", "99999999999999999999"}) {
+    const auto res = rfl::string_to_enum<Color>(str);
+    ASSERT_FALSE(res) << str;
+    EXPECT_EQ(res.error().what(),
+              "Could not convert '" + std::string(str) +
+                  "' to an enum: It is neither one of the enumerators nor a "
+                  "valid integer.");
+  }
+}
+
+TEST(json, test_enums_flags) {
+  const auto rw = Permission::read | Permission::write;
+  EXPECT_EQ(rfl::enum_to_string(rw), "read|write");
+  EXPECT_EQ(rfl::enum_to_string(Permission::execute), "execute");
+  EXPECT_EQ(rfl::enum_to_string(rw | static_cast<Permission>(16)),
+            "read|write|16");
+
+  EXPECT_EQ(rfl::string_to_enum<Permission>("read|write").value(), rw);
+  EXPECT_EQ(rfl::string_to_enum<Permission>("write|read").value(), rw);
+  EXPECT_EQ(rfl::string_to_enum<Permission>("execute|1|2").value(),
+            rw | Permission::execute);
+
+  for (const auto str : {"read|", "|read", "read||write", "read|wrte",
+                         "read|3x", "read,write"}) {
+    EXPECT_FALSE(rfl::string_to_enum<Permission>(str)) << str;
+  }
+}
+
+TEST(json, test_enums_fields) {
+  struct Settings {
+    Color color;
+    Sparse sparse;
+    Permission permission;
+  };
+  const auto settings = Settings{.color = Color::yellow,
+                                 .sparse = Sparse::low,
+                                 .permission = Permission::read |
+                                               Permission::execute};
+  const auto json_str = rfl::json::write(settings);
+  EXPECT_EQ(json_str,
+            R"({"color":"yellow","sparse":"low","permission":"read|execute"})");
+  const auto res = rfl::json::read<Settings>(json_str);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(res->color, settings.color);
+  EXPECT_EQ(res->sparse, settings.sparse);
+  EXPECT_EQ(res->permission, settings.permission);
+
+  EXPECT_FALSE(rfl::json::read<Settings>(
+      R"({"color":"3x","sparse":"low","permission":"read"})"));
+}
+
+}  // namespace test_enums
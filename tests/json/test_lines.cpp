@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_lines {
+
+struct Event {
+  std::string name;
+  int value;
+};
+
+struct Line {
+  size_t line_number;
+  rfl::Result<Event> result;
+};
+
+/// Collects what the reader yields from _input, both from a buffer and from a
+/// stream, and makes sure the two agree.
+std::vector<Line> read_all(const std::string& _input,
+                           const bool _skip_errors = false) {
+  auto from_buffer = std::vector<Line>();
+  auto buffer_reader = rfl::json::lines::Reader<Event>(_input, _skip_errors);
+  for (const auto& res : buffer_reader) {
+    from_buffer.push_back(Line{buffer_reader.line_number(), res});
+  }
+
+  auto stream = std::istringstream(_input);
+  auto from_stream = std::vector<Line>();
+  auto stream_reader = rfl::json::lines::Reader<Event>(stream, _skip_errors);
+  for (const auto& res : stream_reader) {
+    from_stream.push_back(Line{stream_reader.line_number(), res});
+  }
+
+  EXPECT_EQ(from_buffer.size(), from_stream.size());
+  for (size_t i = 0; i < std::min(from_buffer.size(), from_stream.size());
+       ++i) {
+    const auto& b = from_buffer[i];
+    const auto& s = from_stream[i];
+    EXPECT_EQ(b.line_number, s.line_number);
+    EXPECT_EQ(static_cast<bool>(b.result), static_cast<bool>(s.result));
+    if (b.result && s.result) {
+      EXPECT_EQ(b.result->name, s.result->name);
+      EXPECT_EQ(b.result->value, s.result->value);
+    } else if (!b.result && !s.result) {
+      EXPECT_EQ(b.result.error().what(), s.result.error().what());
+    }
+  }
+  return from_buffer;
+}
+
+TEST(json, test_lines) {
+  const auto events = std::vector<Event>{
+      Event{.name = "a", .value = 1}, Event{.name = "b\nc", .value = 2},
+      Event{.name = "", .value = 3}};
+  const auto ndjson = rfl::json::lines::write(events, YYJSON_WRITE_PRETTY);
+  EXPECT_EQ(ndjson,
+            "{\"name\":\"a\",\"value\":1}\n{\"name\":\"b\\nc\",\"value\":2}\n"
+            "{\"name\":\"\",\"value\":3}\n");
+
+  auto stream = std::ostringstream();
+  rfl::json::lines::write(events, stream);
+  EXPECT_EQ(stream.str(), ndjson);
+
+  const auto lines = read_all(ndjson);
+  ASSERT_EQ(lines.size(), events.size());
+  for (size_t i = 0; i < lines.size(); ++i) {
+    ASSERT_TRUE(lines[i].result) << lines[i].result.error().what();
+    EXPECT_EQ(lines[i].line_number, i + 1);
+    EXPECT_EQ(lines[i].result->name, events[i].name);
+    EXPECT_EQ(lines[i].result->value, events[i].value);
+  }
+
+  EXPECT_TRUE(read_all("").empty());
+  EXPECT_TRUE(read_all("\n \r\n\t\n").empty());
+}
+
+TEST(json, test_lines_blank_and_crlf) {
+  // Blank lines are skipped, but still counted.
+  const auto lines = read_all(
+      "\r\n"
+      "{\"name\":\"a\",\"value\":1}\r\n"
+      "   \r\n"
+      "\n"
+      "{\"name\":\"b\",\"value\":2}\n"
+      "\t\r\n"
+      "{\"name\":\"c\",\"value\":3}");
+  ASSERT_EQ(lines.size(), 3u);
+  EXPECT_EQ(lines[0].line_number, 2u);
+  EXPECT_EQ(lines[1].line_number, 5u);
+  EXPECT_EQ(lines[2].line_number, 7u);
+  for (const auto& line : lines) {
+    ASSERT_TRUE(line.result) << line.result.error().what();
+  }
+  EXPECT_EQ(lines[2].result->name, "c");
+}
+
+TEST(json, test_lines_errors) {
+  const auto input = std::string(
+      "{\"name\":\"a\",\"value\":1}\r\n"
+      "\r\n"
+      "{\"name\":\"b\"}\r\n"
+      "not json\n"
+      "{\"name\":\"c\",\"value\":3}\n");
+
+  // Errors carry their line number and do not end the iteration.
+  const auto lines = read_all(input);
+  ASSERT_EQ(lines.size(), 4u);
+  EXPECT_TRUE(lines[0].result);
+  ASSERT_FALSE(lines[1].result);
+  EXPECT_EQ(lines[1].line_number, 3u);
+  EXPECT_EQ(lines[1].result.error().what().rfind("Line 3: ", 0), 0u)
+      << lines[1].result.error().what();
+  ASSERT_FALSE(lines[2].result);
+  EXPECT_EQ(lines[2].line_number, 4u);
+  EXPECT_EQ(lines[2].result.error().what().rfind("Line 4: ", 0), 0u)
+      << lines[2].result.error().what();
+  ASSERT_TRUE(lines[3].result);
+  EXPECT_EQ(lines[3].line_number, 5u);
+
+  // With skip_errors, only the lines that can be parsed remain.
+  const auto skipped = read_all(input, true);
+  ASSERT_EQ(skipped.size(), 2u);
+  EXPECT_EQ(skipped[0].line_number, 1u);
+  EXPECT_EQ(skipped[1].line_number, 5u);
+  EXPECT_EQ(skipped[1].result->name, "c");
+
+  EXPECT_TRUE(read_all("not json\n\n{\"name\":\"b\"}", true).empty());
+}
+
+}  // namespace test_lines
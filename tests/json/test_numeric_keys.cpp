@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace test_numeric_keys {
+
+template <class T>
+void round_trip(const std::map<T, std::string>& _map,
+                const std::string& _expected) {
+  const auto json_str = rfl::json::write(_map);
+  EXPECT_EQ(json_str, _expected);
+  const auto res = rfl::json::read<std::map<T, std::string>>(json_str);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(*res, _map);
+}
+
+template <class T>
+void expect_error(const std::string& _key, const std::string& _message) {
+  const auto res = rfl::json::read<std::map<T, int>>(
+      R"({")" + _key + R"(":1})");
+  ASSERT_FALSE(res) << _key;
+  EXPECT_NE(res.error().what().find("Failed to parse field '" + _key +
+                                    "': " + _message),
+            std::string::npos)
+      << res.error().what();
+}
+
+TEST(json, test_numeric_keys) {
+  using I8 = std::numeric_limits<std::int8_t>;
+  using I64 = std::numeric_limits<std::int64_t>;
+  using U64 = std::numeric_limits<std::uint64_t>;
+
+  round_trip<std::int8_t>({{I8::min(), "a"}, {-1, "b"}, {I8::max(), "c"}},
+                          R"({"-128":"a","-1":"b","127":"c"})");
+  round_trip<std::int64_t>({{I64::min(), "a"}, {0, "b"}, {I64::max(), "c"}},
+                           R"({"-9223372036854775808":"a","0":"b",)"
+                           R"("9223372036854775807":"c"})");
+  round_trip<std::uint64_t>({{0, "a"}, {U64::max(), "b"}},
+                            R"({"0":"a","18446744073709551615":"b"})");
+  round_trip<double>({{-1.5, "a"}, {0.25, "b"}},
+                     R"({"-1.500000":"a","0.250000":"b"})");
+
+  const auto unordered = std::unordered_map<int, int>{{-42, 1}, {7, 2}};
+  const auto res = rfl::json::read<std::unordered_map<int, int>>(
+      rfl::json::write(unordered));
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(*res, unordered);
+}
+
+TEST(json, test_numeric_keys_rejected) {
+  // Unlike std::stoll, which accepted these, the whole key must be a number.
+  for (const auto key : {"+1", "1x", "x1", "", " 1", "1 ", "1.5", "0x10"}) {
+    expect_error<int>(key,
+                      "Could not convert key '" + std::string(key) +
+                          "' to a number.");
+  }
+  expect_error<unsigned int>("-1", "Could not convert key '-1' to a number.");
+  expect_error<double>("1.5x", "Could not convert key '1.5x' to a number.");
+
+  expect_error<std::int8_t>("128", "Key '128' is out of range.");
+  expect_error<std::int8_t>("-129", "Key '-129' is out of range.");
+  expect_error<std::int64_t>("9223372036854775808",
+                             "Key '9223372036854775808' is out of range.");
+  expect_error<std::uint64_t>("18446744073709551616",
+                              "Key '18446744073709551616' is out of range.");
+}
+
+}  // namespace test_numeric_keys
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace test_parallel {
+
+/// Whether any value has been validated while an array was read in parallel.
+std::atomic<bool> was_read_in_parallel = false;
+
+struct RecordThread {
+  template <class T>
+  static rfl::Result<T> validate(T _value) noexcept {
+    if (rfl::parsing::is_reading_in_parallel()) {
+      was_read_in_parallel = true;
+    }
+    return _value;
+  }
+};
+
+struct Record {
+  std::string name;
+  rfl::Validator<int, rfl::Minimum<0>> id;
+  rfl::Validator<std::vector<int>, RecordThread> values;
+};
+
+/// Makes sure several threads are used, even on a machine with a single
+/// core, and restores the original setting afterwards.
+class WithThreads {
+ public:
+  explicit WithThreads(const size_t _n)
+      : original_(rfl::parsing::max_threads().load()) {
+    rfl::parsing::max_threads() = _n;
+    was_read_in_parallel = false;
+  }
+
+  ~WithThreads() { rfl::parsing::max_threads() = original_; }
+
+ private:
+  size_t original_;
+};
+
+std::vector<Record> make_records(const int _n) {
+  auto records = std::vector<Record>();
+  for (int i = 0; i < _n; ++i) {
+    records.push_back(Record{.name = "record " + std::to_string(i),
+                             .id = i,
+                             .values = std::vector<int>(i % 5, i)});
+  }
+  return records;
+}
+
+TEST(json, test_parallel) {
+  const auto with_threads = WithThreads(4);
+
+  const auto json_str = rfl::json::write(make_records(10000));
+  const auto expected = rfl::json::read<std::vector<Record>>(json_str);
+  ASSERT_TRUE(expected) << expected.error().what();
+  EXPECT_FALSE(was_read_in_parallel);
+
+  const auto actual =
+      rfl::json::read<std::vector<Record>, rfl::Parallel>(json_str);
+  ASSERT_TRUE(actual) << actual.error().what();
+  EXPECT_TRUE(was_read_in_parallel);
+  EXPECT_EQ(rfl::json::write(*actual), rfl::json::write(*expected));
+}
+
+TEST(json, test_parallel_small_arrays) {
+  const auto with_threads = WithThreads(4);
+
+  // Arrays with fewer than 8192 elements are not worth splitting.
+  const auto json_str = rfl::json::write(make_records(8191));
+  const auto actual =
+      rfl::json::read<std::vector<Record>, rfl::Parallel>(json_str);
+  ASSERT_TRUE(actual) << actual.error().what();
+  EXPECT_FALSE(was_read_in_parallel);
+  EXPECT_EQ(rfl::json::write(*actual), json_str);
+}
+
+TEST(json, test_parallel_errors) {
+  const auto with_threads = WithThreads(4);
+
+  // The failures are spread across the chunks of different threads, the
+  // error of the lowest index must win, like in a sequential read.
+  for (const auto& failing : std::vector<std::vector<int>>{
+           {9000, 3000, 7000}, {9999}, {0, 9999}, {5000, 4999}}) {
+    auto records = make_records(10000);
+    for (const auto i : failing) {
+      records[i].id = 0;
+    }
+    auto json_str = rfl::json::write(records);
+    for (const auto i : failing) {
+      const auto field =
+          "\"name\":\"record " + std::to_string(i) + "\",\"id\":0";
+      const auto pos = json_str.find(field);
+      ASSERT_NE(pos, std::string::npos);
+      json_str.replace(pos + field.size() - 1, 1, std::to_string(-i - 1));
+    }
+
+    const auto expected = rfl::json::read<std::vector<Record>>(json_str);
+    ASSERT_FALSE(expected);
+    const auto actual =
+        rfl::json::read<std::vector<Record>, rfl::Parallel>(json_str);
+    ASSERT_FALSE(actual);
+    EXPECT_EQ(actual.error().what(), expected.error().what());
+    const auto lowest = *std::min_element(failing.begin(), failing.end());
+    EXPECT_NE(actual.error().what().find("but got " +
+                                         std::to_string(-lowest - 1) + "."),
+              std::string::npos)
+        << actual.error().what();
+  }
+}
+
+TEST(json, test_parallel_nested) {
+  const auto with_threads = WithThreads(4);
+
+  // The outer array is large enough to be read in parallel, the inner arrays
+  // are then read sequentially by each thread.
+  auto outer = std::vector<std::vector<Record>>(9000);
+  for (size_t i = 0; i < outer.size(); ++i) {
+    outer[i] = make_records(static_cast<int>(i % 3));
+  }
+  const auto outer_str = rfl::json::write(outer);
+  const auto outer_res =
+      rfl::json::read<std::vector<std::vector<Record>>, rfl::Parallel>(
+          outer_str);
+  ASSERT_TRUE(outer_res) << outer_res.error().what();
+  EXPECT_EQ(rfl::json::write(*outer_res), outer_str);
+
+  // Here, only the inner arrays are large enough.
+  const auto inner = std::vector<std::vector<Record>>{
+      make_records(9000), make_records(3), make_records(8500)};
+  const auto inner_str = rfl::json::write(inner);
+  was_read_in_parallel = false;
+  const auto inner_res =
+      rfl::json::read<std::vector<std::vector<Record>>, rfl::Parallel>(
+          inner_str);
+  ASSERT_TRUE(inner_res) << inner_res.error().what();
+  EXPECT_TRUE(was_read_in_parallel);
+  EXPECT_EQ(rfl::json::write(*inner_res), inner_str);
+}
+
+}  // namespace test_parallel
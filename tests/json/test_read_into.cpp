@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace test_read_into {
+
+struct Address {
+  std::string street;
+  std::string city;
+};
+
+struct Person {
+  std::string name;
+  std::vector<std::string> tags;
+  std::vector<int> scores;
+  Address address;
+  std::optional<std::string> nickname;
+  std::optional<Address> work;
+  std::map<std::string, int> ranks;
+};
+
+Person make_person() {
+  return Person{
+      .name = std::string(100, 'a'),
+      .tags = {std::string(50, 'x'), std::string(50, 'y'),
+               std::string(50, 'z')},
+      .scores = {1, 2, 3, 4, 5, 6, 7, 8},
+      .address = Address{.street = std::string(40, 's'),
+                         .city = std::string(40, 'c')},
+      .nickname = std::string(30, 'n'),
+      .work = Address{.street = std::string(40, 'w'), .city = "Shelbyville"},
+      .ranks = {{"a", 1}, {"b", 2}}};
+}
+
+TEST(json, test_read_into) {
+  const auto expected = Person{
+      .name = "Homer",
+      .tags = {"nuclear", "safety"},
+      .scores = {10, 20, 30},
+      .address = Address{.street = "742 Evergreen Terrace",
+                         .city = "Springfield"},
+      .nickname = "Homie",
+      .work = Address{.street = "Power Plant", .city = "Springfield"},
+      .ranks = {{"c", 3}}};
+  const auto json_str = rfl::json::write(expected);
+
+  auto person = make_person();
+  const auto res = rfl::json::read_into(person, json_str);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(rfl::json::write(person), json_str);
+  EXPECT_EQ(rfl::json::write(person),
+            rfl::json::write(rfl::json::read<Person>(json_str).value()));
+}
+
+TEST(json, test_read_into_reuses_capacity) {
+  auto person = make_person();
+  const auto name = person.name.data();
+  const auto tags = person.tags.data();
+  const auto first_tag = person.tags[0].data();
+  const auto scores = person.scores.data();
+  const auto street = person.address.street.data();
+  const auto nickname = person.nickname->data();
+  const auto work_street = person.work->street.data();
+
+  const auto res = rfl::json::read_into(
+      person,
+      R"({"name":"Homer","tags":["nuclear","safety"],"scores":[1,2],)"
+      R"("address":{"street":"Evergreen Terrace","city":"Springfield"},)"
+      R"("nickname":"Homie","work":{"street":"Plant","city":"Springfield"},)"
+      R"("ranks":{}})");
+  ASSERT_TRUE(res) << res.error().what();
+
+  EXPECT_EQ(person.name, "Homer");
+  EXPECT_EQ(person.name.data(), name);
+  EXPECT_EQ(person.tags.data(), tags);
+  EXPECT_EQ(person.tags[0], "nuclear");
+  EXPECT_EQ(person.tags[0].data(), first_tag);
+  EXPECT_EQ(person.scores.data(), scores);
+  EXPECT_EQ(person.address.street, "Evergreen Terrace");
+  EXPECT_EQ(person.address.street.data(), street);
+  EXPECT_EQ(*person.nickname, "Homie");
+  EXPECT_EQ(person.nickname->data(), nickname);
+  EXPECT_EQ(person.work->street, "Plant");
+  EXPECT_EQ(person.work->street.data(), work_street);
+  EXPECT_TRUE(person.ranks.empty());
+}
+
+TEST(json, test_read_into_shrinks_and_grows) {
+  auto person = make_person();
+
+  const auto shorter = rfl::json::read_into(
+      person,
+      R"({"name":"a","tags":["b"],"scores":[],"address":{"street":"",)"
+      R"("city":""},"ranks":{}})");
+  ASSERT_TRUE(shorter) << shorter.error().what();
+  EXPECT_EQ(person.tags, std::vector<std::string>({"b"}));
+  EXPECT_TRUE(person.scores.empty());
+
+  const auto longer = rfl::json::read_into(
+      person,
+      R"({"name":"a","tags":["b","c","d","e","f"],"scores":[1,2,3,4,5,6,7,)"
+      R"(8,9,10],"address":{"street":"","city":""},"ranks":{}})");
+  ASSERT_TRUE(longer) << longer.error().what();
+  EXPECT_EQ(person.tags, std::vector<std::string>({"b", "c", "d", "e", "f"}));
+  EXPECT_EQ(person.scores,
+            std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+}
+
+TEST(json, test_read_into_missing_fields) {
+  // Optional fields that are missing from the input are reset, rather than
+  // keeping the values from before.
+  auto person = make_person();
+  const auto res = rfl::json::read_into(
+      person,
+      R"({"name":"Homer","tags":[],"scores":[],)"
+      R"("address":{"street":"","city":""},"ranks":{}})");
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_FALSE(person.nickname);
+  EXPECT_FALSE(person.work);
+
+  // Optional fields that are null are reset as well, and the ones that were
+  // empty before are filled.
+  const auto filled = rfl::json::read_into(
+      person,
+      R"({"name":"Homer","tags":[],"scores":[],"nickname":null,)"
+      R"("address":{"street":"","city":""},"ranks":{},)"
+      R"("work":{"street":"Plant","city":"Springfield"}})");
+  ASSERT_TRUE(filled) << filled.error().what();
+  EXPECT_FALSE(person.nickname);
+  ASSERT_TRUE(person.work);
+  EXPECT_EQ(person.work->street, "Plant");
+
+  // Required fields must be present, just like in read.
+  const auto missing = rfl::json::read_into(
+      person, R"({"name":"Homer","tags":[],"scores":[],"ranks":{}})");
+  ASSERT_FALSE(missing);
+  EXPECT_EQ(missing.error().what(),
+            rfl::json::read<Person>(
+                R"({"name":"Homer","tags":[],"scores":[],"ranks":{}})")
+                .error()
+                .what());
+}
+
+TEST(json, test_read_into_nested_containers) {
+  auto nested = std::vector<std::vector<Address>>{
+      {Address{.street = "a", .city = "b"}, Address{.street = "c"}},
+      {},
+      {Address{.street = "d"}}};
+  const auto first = nested[0].data();
+
+  const auto expected = std::vector<std::vector<Address>>{
+      {Address{.street = "e", .city = "f"}},
+      {Address{.street = "g"}, Address{.street = "h"}}};
+  const auto json_str = rfl::json::write(expected);
+  const auto res = rfl::json::read_into(nested, json_str);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(rfl::json::write(nested), json_str);
+  EXPECT_EQ(nested[0].data(), first);
+}
+
+}  // namespace test_read_into
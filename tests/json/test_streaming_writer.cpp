@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <random>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_streaming_writer {
+
+using Streaming = rfl::json::Streaming;
+
+struct Inner {
+  std::string text;
+  std::vector<int> empty;
+  std::map<std::string, std::string> by_name;
+};
+
+struct Outer {
+  std::vector<std::string> strings;
+  std::vector<double> doubles;
+  std::vector<float> floats;
+  std::vector<std::int64_t> signed_ints;
+  std::vector<std::uint64_t> unsigned_ints;
+  std::optional<Inner> inner;
+  std::optional<std::string> nothing;
+  std::vector<Inner> inners;
+  bool flag;
+};
+
+/// Every flag the StreamingWriter supports.
+constexpr yyjson_write_flag supported_flags[] = {
+    YYJSON_WRITE_PRETTY,          YYJSON_WRITE_PRETTY_TWO_SPACES,
+    YYJSON_WRITE_ESCAPE_UNICODE,  YYJSON_WRITE_ESCAPE_SLASHES,
+    YYJSON_WRITE_ALLOW_INF_AND_NAN, YYJSON_WRITE_NEWLINE_AT_END};
+
+constexpr size_t num_flags = std::size(supported_flags);
+
+yyjson_write_flag combine_flags(const size_t _bits) {
+  yyjson_write_flag flag = 0;
+  for (size_t i = 0; i < num_flags; ++i) {
+    if (_bits & (size_t(1) << i)) {
+      flag |= supported_flags[i];
+    }
+  }
+  return flag;
+}
+
+std::string to_utf8(const std::uint32_t _cp) {
+  std::string s;
+  if (_cp < 0x80) {
+    s += static_cast<char>(_cp);
+  } else if (_cp < 0x800) {
+    s += static_cast<char>(0xc0 | (_cp >> 6));
+    s += static_cast<char>(0x80 | (_cp & 0x3f));
+  } else if (_cp < 0x10000) {
+    s += static_cast<char>(0xe0 | (_cp >> 12));
+    s += static_cast<char>(0x80 | ((_cp >> 6) & 0x3f));
+    s += static_cast<char>(0x80 | (_cp & 0x3f));
+  } else {
+    s += static_cast<char>(0xf0 | (_cp >> 18));
+    s += static_cast<char>(0x80 | ((_cp >> 12) & 0x3f));
+    s += static_cast<char>(0x80 | ((_cp >> 6) & 0x3f));
+    s += static_cast<char>(0x80 | (_cp & 0x3f));
+  }
+  return s;
+}
+
+std::vector<std::string> make_strings(std::mt19937* _rng) {
+  auto strings = std::vector<std::string>{
+      "", "plain", "\"quoted\"", "back\\slash", "a/b</script>", "\x7f",
+      "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80", "\xe2\x80\xa8\xe2\x80\xa9",
+      "\xef\xbf\xbf", "\xf4\x8f\xbf\xbf"};
+  for (std::uint32_t c = 0; c < 0x20; ++c) {
+    strings.push_back("x" + std::string(1, static_cast<char>(c)) + "y");
+  }
+  // Random valid UTF-8, weighted towards the characters that need escaping.
+  const std::uint32_t limits[] = {0x20, 0x80, 0x800, 0x10000, 0x110000};
+  for (int i = 0; i < 200; ++i) {
+    std::string s;
+    const auto len = (*_rng)() % 40;
+    for (size_t j = 0; j < len; ++j) {
+      auto cp = (*_rng)() % limits[(*_rng)() % std::size(limits)];
+      if (cp >= 0xd800 && cp < 0xe000) {
+        cp = '"';
+      }
+      s += to_utf8(cp);
+    }
+    strings.push_back(s);
+  }
+  return strings;
+}
+
+std::vector<double> make_doubles(std::mt19937_64* _rng) {
+  using L = std::numeric_limits<double>;
+  auto doubles = std::vector<double>{
+      0.0,      -0.0,     1.0,       -1.0,      0.1,        1.0 / 3.0,
+      1e21,     1e-7,     123456789012345680.0, 9007199254740993.0,
+      L::max(), L::min(), L::denorm_min(), L::lowest(), 5e-324, 1e300};
+  while (doubles.size() < 1000) {
+    const auto d = std::bit_cast<double>((*_rng)());
+    if (std::isfinite(d)) {
+      doubles.push_back(d);
+    }
+  }
+  return doubles;
+}
+
+std::vector<float> make_floats(std::mt19937* _rng) {
+  using L = std::numeric_limits<float>;
+  auto floats = std::vector<float>{0.0f,     -0.0f,    0.1f,
+                                   1.0f / 3, L::max(), L::min(),
+                                   L::denorm_min(), 16777217.0f};
+  while (floats.size() < 1000) {
+    const auto f = std::bit_cast<float>(static_cast<std::uint32_t>((*_rng)()));
+    if (std::isfinite(f)) {
+      floats.push_back(f);
+    }
+  }
+  return floats;
+}
+
+Outer make_outer() {
+  auto rng = std::mt19937(7);
+  auto rng64 = std::mt19937_64(7);
+  using I = std::numeric_limits<std::int64_t>;
+  using U = std::numeric_limits<std::uint64_t>;
+  const auto strings = make_strings(&rng);
+  auto inner = Inner{.text = strings.at(6), .by_name = {}};
+  for (size_t i = 0; i < 20; ++i) {
+    inner.by_name[strings.at(i)] = strings.at(strings.size() - 1 - i);
+  }
+  return Outer{
+      .strings = strings,
+      .doubles = make_doubles(&rng64),
+      .floats = make_floats(&rng),
+      .signed_ints = {0, -1, 1, I::min(), I::max(), I::min() + 1, -(1LL << 53)},
+      .unsigned_ints = {0, 1, U::max(), U::max() - 1, 1ULL << 63},
+      .inner = inner,
+      .nothing = std::nullopt,
+      .inners = {inner, Inner{}},
+      .flag = true};
+}
+
+/// write<Streaming> must produce exactly what yyjson produces.
+template <class T>
+void expect_same(const T& _obj, const yyjson_write_flag _flag) {
+  const auto expected = rfl::json::write(_obj, _flag);
+  EXPECT_EQ(rfl::json::write<Streaming>(_obj, _flag), expected)
+      << "flag: " << _flag;
+
+  auto stream = std::ostringstream();
+  rfl::json::write<Streaming>(_obj, stream, _flag);
+  EXPECT_EQ(stream.str(), expected) << "flag: " << _flag;
+}
+
+TEST(json, test_streaming_writer) {
+  const auto outer = make_outer();
+  for (size_t bits = 0; bits < (size_t(1) << num_flags); ++bits) {
+    expect_same(outer, combine_flags(bits));
+  }
+}
+
+TEST(json, test_streaming_writer_inf_and_nan) {
+  using L = std::numeric_limits<double>;
+  const auto values = std::vector<double>{L::infinity(), -L::infinity(),
+                                          L::quiet_NaN(), 1.5};
+  for (size_t bits = 0; bits < (size_t(1) << num_flags); ++bits) {
+    const auto flag = combine_flags(bits);
+    if (flag & YYJSON_WRITE_ALLOW_INF_AND_NAN) {
+      expect_same(values, flag);
+    } else {
+      // yyjson refuses to write these, but the StreamingWriter cannot fail
+      // halfway through, so it writes null instead.
+      const auto expected = rfl::json::write<Streaming>(
+          std::vector<std::optional<double>>{std::nullopt, std::nullopt,
+                                             std::nullopt, 1.5},
+          flag);
+      EXPECT_EQ(rfl::json::write<Streaming>(values, flag), expected);
+    }
+  }
+}
+
+TEST(json, test_streaming_writer_large_stream) {
+  // Larger than the chunk the stream is written in, including a single
+  // string that does not fit into it.
+  auto outer = make_outer();
+  outer.strings.push_back(std::string(100000, 'x'));
+  for (int i = 0; i < 10; ++i) {
+    outer.inners.insert(outer.inners.end(), outer.inners.begin(),
+                        outer.inners.end());
+  }
+  expect_same(outer, 0);
+  expect_same(outer, YYJSON_WRITE_PRETTY | YYJSON_WRITE_ESCAPE_UNICODE);
+}
+
+}  // namespace test_streaming_writer
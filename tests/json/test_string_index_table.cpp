@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <rfl.hpp>
+#include <rfl/internal/StringIndexTable.hpp>
+#include <string_view>
+
+namespace test_string_index_table {
+
+constexpr auto names = std::array<std::string_view, 7>{
+    "name", "id", "score", "tags", "nested", "flag", "nickname"};
+
+void expect_lookups(const rfl::internal::StringIndexTable<7>& _table) {
+  for (size_t i = 0; i < names.size(); ++i) {
+    EXPECT_EQ(_table.find(names[i]), static_cast<int>(i));
+    EXPECT_EQ(_table.str(i), names[i]);
+  }
+  for (const auto unknown : {"", "junk", "bytes", "more", "nicknam"}) {
+    EXPECT_EQ(_table.find(unknown), -1);
+  }
+}
+
+TEST(json, test_string_index_table) {
+  constexpr auto at_compile_time = rfl::internal::StringIndexTable<7>(names);
+  expect_lookups(at_compile_time);
+
+  // Every slot that is not taken must be marked as empty at run time, too,
+  // or looking up an unknown key never terminates.
+  const auto at_run_time = rfl::internal::StringIndexTable<7>(names);
+  expect_lookups(at_run_time);
+}
+
+}  // namespace test_string_index_table
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_string_view {
+
+struct Person {
+  std::string_view first_name;
+  std::vector<std::string_view> tags;
+};
+
+TEST(json, test_string_view) {
+  // The views are not null-terminated and may contain null characters, so
+  // the writer must respect their length.
+  const auto buffer = std::string("Homer\0Simpson|nuclear,safety", 28);
+  const auto person = Person{
+      .first_name = std::string_view(buffer.data(), 13),
+      .tags = {std::string_view(buffer.data() + 14, 7),
+               std::string_view(buffer.data() + 22, 6)}};
+  const auto expected = R"({"first_name":"Homer\u0000Simpson",)"
+                        R"("tags":["nuclear","safety"]})";
+  EXPECT_EQ(rfl::json::write(person), expected);
+  EXPECT_EQ(rfl::json::write<rfl::json::Streaming>(person), expected);
+}
+
+}  // namespace test_string_view
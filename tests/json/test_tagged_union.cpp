@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace test_tagged_union {
+
+using CircleTag = rfl::Literal<"circle", "round">;
+
+/// Several tags may belong to the same alternative.
+struct Circle {
+  CircleTag shape;
+  double radius;
+};
+
+struct Square {
+  rfl::Literal<"square"> shape;
+  double width;
+};
+
+/// Tagged by its type name.
+struct Rectangle {
+  double height;
+  double width;
+};
+
+/// Tagged by its Tag.
+struct Triangle {
+  using Tag = rfl::Literal<"triangle">;
+  double base;
+  double height;
+};
+
+struct Point {
+  using Tag = rfl::Literal<"point">;
+};
+
+using Shape =
+    rfl::TaggedUnion<"shape", Circle, Square, Rectangle, Triangle, Point>;
+
+TEST(json, test_tagged_union) {
+  const auto shapes = std::vector<Shape>{
+      Circle{.shape = CircleTag("circle"), .radius = 1.0},
+      Circle{.shape = CircleTag("round"), .radius = 2.0},
+      Square{.width = 3.0},
+      Rectangle{.height = 4.0, .width = 5.0},
+      Triangle{.base = 6.0, .height = 7.0},
+      Point{}};
+  const auto json_str = rfl::json::write(shapes);
+  EXPECT_EQ(json_str,
+            R"([{"shape":"circle","radius":1.0},)"
+            R"({"shape":"round","radius":2.0},)"
+            R"({"shape":"square","width":3.0},)"
+            R"({"shape":"Rectangle","height":4.0,"width":5.0},)"
+            R"({"shape":"triangle","base":6.0,"height":7.0},)"
+            R"({"shape":"point"}])");
+
+  const auto res = rfl::json::read<std::vector<Shape>>(json_str);
+  ASSERT_TRUE(res) << res.error().what();
+  ASSERT_EQ(res->size(), shapes.size());
+  for (size_t i = 0; i < shapes.size(); ++i) {
+    EXPECT_EQ((*res)[i].variant().index(), shapes[i].variant().index());
+  }
+  EXPECT_EQ(rfl::json::write(*res), json_str);
+
+  // The discriminator does not have to come first.
+  const auto square =
+      rfl::json::read<Shape>(R"({"width":3.0,"shape":"square"})");
+  ASSERT_TRUE(square) << square.error().what();
+  EXPECT_EQ(square->variant().index(), 1u);
+}
+
+TEST(json, test_tagged_union_errors) {
+  // Tags are matched exactly.
+  for (const auto tag : {"hexagon", "", "Circle", "circles", "squar", "rou"}) {
+    const auto res = rfl::json::read<Shape>(
+        R"({"shape":")" + std::string(tag) + R"(","radius":1.0})");
+    ASSERT_FALSE(res) << tag;
+    EXPECT_EQ(res.error().what(),
+              "Could not parse tagged union, could not match shape '" +
+                  std::string(tag) +
+                  "'. The following tags are allowed: circle, round, "
+                  "square, Rectangle, triangle, point");
+  }
+
+  // A known tag with the wrong fields reports the alternative it tried.
+  const auto wrong_fields =
+      rfl::json::read<Shape>(R"({"shape":"round","width":1.0})");
+  ASSERT_FALSE(wrong_fields);
+  EXPECT_EQ(wrong_fields.error().what().rfind(
+                "Could not parse tagged union with discrimininator shape "
+                "'round': ",
+                0),
+            0u)
+      << wrong_fields.error().what();
+
+  const auto missing = rfl::json::read<Shape>(R"({"radius":1.0})");
+  ASSERT_FALSE(missing);
+  EXPECT_EQ(missing.error().what().rfind(
+                "Could not parse tagged union: Could not find field 'shape'",
+                0),
+            0u)
+      << missing.error().what();
+
+  EXPECT_FALSE(rfl::json::read<Shape>(R"({"shape":1,"radius":1.0})"));
+}
+
+}  // namespace test_tagged_union
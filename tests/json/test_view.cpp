@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace test_view {
+
+struct Message {
+  std::string first_name;
+  int age;
+  std::optional<std::string> nick_name;
+  std::vector<int> scores;
+};
+
+const auto message = Message{.first_name = "Homer",
+                             .age = 45,
+                             .nick_name = "Homie",
+                             .scores = {1, 2, 3}};
+
+TEST(json, test_view) {
+  auto view = rfl::json::read_view<Message>(rfl::json::write(message)).value();
+  EXPECT_FALSE(view.is_decoded<"first_name">());
+  EXPECT_FALSE(view.is_decoded<"age">());
+
+  const auto& age = view.get<"age">();
+  ASSERT_TRUE(age) << age.error().what();
+  EXPECT_EQ(*age, 45);
+  EXPECT_TRUE(view.is_decoded<"age">());
+  EXPECT_FALSE(view.is_decoded<"first_name">());
+  EXPECT_FALSE(view.is_decoded<"scores">());
+
+  // The second access returns the cached result.
+  EXPECT_EQ(&view.get<"age">(), &age);
+
+  EXPECT_EQ(view.get<"first_name">().value(), "Homer");
+  EXPECT_EQ(view.get<"nick_name">().value(), "Homie");
+  EXPECT_EQ(view.get<"scores">().value(), std::vector<int>({1, 2, 3}));
+
+  // Copies share the document, but not the cache.
+  auto copy = view;
+  auto fresh = rfl::json::read_view<Message>(rfl::json::write(message)).value();
+  auto fresh_copy = fresh;
+  EXPECT_TRUE(copy.is_decoded<"scores">());
+  EXPECT_EQ(fresh_copy.get<"scores">().value(), std::vector<int>({1, 2, 3}));
+  EXPECT_FALSE(fresh.is_decoded<"scores">());
+}
+
+TEST(json, test_view_missing_fields) {
+  auto view =
+      rfl::json::read_view<Message>(R"({"first_name":"Homer"})").value();
+
+  // Missing optional fields are empty, missing required fields are errors,
+  // just like in read.
+  const auto& nick_name = view.get<"nick_name">();
+  ASSERT_TRUE(nick_name) << nick_name.error().what();
+  EXPECT_FALSE(*nick_name);
+
+  const auto& age = view.get<"age">();
+  ASSERT_FALSE(age);
+  EXPECT_EQ(age.error().what(), "Field named 'age' not found.");
+  EXPECT_FALSE(view.get<"scores">());
+
+  // Errors are cached, too.
+  EXPECT_TRUE(view.is_decoded<"age">());
+  EXPECT_EQ(&view.get<"age">(), &age);
+
+  // With DefaultIfMissing, nothing is required.
+  auto lenient = rfl::json::read_view<Message, rfl::DefaultIfMissing>(
+                     R"({"first_name":"Homer"})")
+                     .value();
+  EXPECT_EQ(lenient.get<"age">().value(), 0);
+  EXPECT_TRUE(lenient.get<"scores">().value().empty());
+}
+
+TEST(json, test_view_errors) {
+  auto view = rfl::json::read_view<Message>(
+                  R"({"first_name":1,"age":45,"scores":[1,"x"]})")
+                  .value();
+  EXPECT_EQ(view.get<"age">().value(), 45);
+  const auto& first_name = view.get<"first_name">();
+  ASSERT_FALSE(first_name);
+  EXPECT_EQ(first_name.error().what().rfind(
+                "Failed to parse field 'first_name': ", 0),
+            0u)
+      << first_name.error().what();
+  EXPECT_FALSE(view.get<"scores">());
+
+  EXPECT_FALSE(rfl::json::read_view<Message>("[1,2,3]"));
+  EXPECT_FALSE(rfl::json::read_view<Message>("{"));
+}
+
+TEST(json, test_view_processors) {
+  // Fields are still referred to by their names in the struct, the
+  // processors only change the keys that are looked up.
+  const auto camel_case =
+      rfl::json::write<rfl::SnakeCaseToCamelCase>(message);
+  ASSERT_NE(camel_case.find("\"firstName\""), std::string::npos);
+  auto camel_view =
+      rfl::json::read_view<Message, rfl::SnakeCaseToCamelCase>(camel_case)
+          .value();
+  EXPECT_EQ(camel_view.get<"first_name">().value(), "Homer");
+  EXPECT_EQ(camel_view.get<"nick_name">().value(), "Homie");
+  EXPECT_EQ(camel_view.get<"age">().value(), 45);
+
+  // rfl::AddStructName prepends a field, which must not shift the others.
+  const auto with_name =
+      rfl::json::write<rfl::AddStructName<"type">, rfl::SnakeCaseToCamelCase>(
+          message);
+  ASSERT_EQ(with_name.rfind(R"({"type":"Message",)", 0), 0u) << with_name;
+  auto named_view = rfl::json::read_view<Message, rfl::AddStructName<"type">,
+                                         rfl::SnakeCaseToCamelCase>(with_name)
+                        .value();
+  EXPECT_EQ(named_view.get<"first_name">().value(), "Homer");
+  EXPECT_EQ(named_view.get<"age">().value(), 45);
+  EXPECT_EQ(named_view.get<"nick_name">().value(), "Homie");
+  EXPECT_EQ(named_view.get<"scores">().value(), std::vector<int>({1, 2, 3}));
+}
+
+}  // namespace test_view
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace test_write_context {
+
+struct Person {
+  std::string first_name;
+  std::string last_name;
+  int age;
+};
+
+TEST(json, test_write_context) {
+  auto ctx = rfl::json::Context();
+
+  const auto crowd = std::vector<Person>(
+      100000, Person{.first_name = "Homer", .last_name = "Simpson", .age = 45});
+
+  const auto large = std::string(rfl::json::write(crowd, ctx));
+  EXPECT_EQ(large, rfl::json::write(crowd));
+
+  // The buffer keeps the capacity of the large document, but must not hand
+  // any of it out beyond what the small documents need.
+  const auto* data = ctx.buffer()->data();
+  const auto homer =
+      Person{.first_name = "Homer", .last_name = "Simpson", .age = 45};
+  for (int i = 0; i < 1000; ++i) {
+    const auto small = rfl::json::write(homer, ctx);
+    ASSERT_EQ(small, R"({"first_name":"Homer","last_name":"Simpson","age":45})");
+    ASSERT_EQ(ctx.buffer()->size(), small.size());
+  }
+  EXPECT_EQ(ctx.buffer()->data(), data);
+  EXPECT_GE(ctx.buffer()->capacity(), large.size());
+}
+
+TEST(json, test_write_to_reserved_string) {
+  const auto homer =
+      Person{.first_name = "Homer", .last_name = "Simpson", .age = 45};
+
+  auto out = std::string("prefix:");
+  out.reserve(8 << 20);
+  const auto* data = out.data();
+
+  rfl::json::write_to(homer, out);
+  EXPECT_EQ(out,
+            R"(prefix:{"first_name":"Homer","last_name":"Simpson","age":45})");
+  EXPECT_EQ(out.data(), data);
+
+  out.clear();
+  rfl::json::write_to(homer, out);
+  EXPECT_EQ(out, R"({"first_name":"Homer","last_name":"Simpson","age":45})");
+  EXPECT_EQ(out.data(), data);
+}
+
+TEST(json, test_output_buffer_grows_on_demand) {
+  auto str = std::string();
+  str.reserve(8 << 20);
+
+  // Only the memory actually written to may be claimed, anything else
+  // would be zero-filled on every write.
+  auto buffer = rfl::json::OutputBuffer(&str);
+  EXPECT_EQ(str.size(), 0);
+  buffer.append("{}");
+  EXPECT_LT(str.size(), 1024);
+  EXPECT_EQ(buffer.finish(), 2);
+  EXPECT_EQ(str, "{}");
+}
+
+}  // namespace test_write_context
@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace test_key_index {
+
+/// A key of a map: a string or, if name is empty, an integer.
+struct Key {
+  std::string name;
+};
+
+/// Encodes a map whose value at position i is the integer i, so a lookup
+/// tells us which key it found. Records where each key and each value ends.
+std::vector<char> encode(const std::vector<Key>& _keys,
+                         std::vector<size_t>* _key_ends,
+                         std::vector<size_t>* _value_ends) {
+  auto bytes = std::vector<char>{'\xde', static_cast<char>(_keys.size() >> 8),
+                                 static_cast<char>(_keys.size() & 0xff)};
+  for (size_t i = 0; i < _keys.size(); ++i) {
+    if (_keys[i].name.empty()) {
+      bytes.push_back('\x07');
+    } else {
+      bytes.push_back(static_cast<char>(0xa0 | _keys[i].name.size()));
+      bytes.insert(bytes.end(), _keys[i].name.begin(), _keys[i].name.end());
+    }
+    _key_ends->push_back(bytes.size());
+    bytes.push_back('\xcd');
+    bytes.push_back(static_cast<char>(i >> 8));
+    bytes.push_back(static_cast<char>(i & 0xff));
+    _value_ends->push_back(bytes.size());
+  }
+  return bytes;
+}
+
+/// What a linear scan over the first _size bytes finds: the position of the
+/// value or an error.
+struct Expected {
+  std::optional<size_t> pos;
+  std::string error;
+  bool has_field;
+};
+
+Expected scan(const std::vector<Key>& _keys,
+              const std::vector<size_t>& _key_ends,
+              const std::vector<size_t>& _value_ends, const size_t _size,
+              const std::string& _name) {
+  auto expected = Expected{.pos = std::nullopt,
+                           .error = "No field named '" + _name +
+                                    "' was found.",
+                           .has_field = false};
+  bool has_field_stopped = false;
+  bool get_stopped = false;
+  for (size_t i = 0; i < _keys.size(); ++i) {
+    if (_key_ends[i] > _size) {
+      if (!get_stopped) {
+        expected.error =
+            "Key in element " + std::to_string(i) + " was not a string.";
+      }
+      return expected;
+    }
+    const bool is_match = _keys[i].name == _name;
+    if (_keys[i].name.empty() && !get_stopped) {
+      expected.error =
+          "Key in element " + std::to_string(i) + " was not a string.";
+      get_stopped = true;
+    }
+    if (is_match && !get_stopped) {
+      expected.pos = i;
+      get_stopped = true;
+    }
+    if (is_match && !has_field_stopped) {
+      expected.has_field = true;
+      has_field_stopped = true;
+    }
+    if (_value_ends[i] > _size) {
+      if (!get_stopped) {
+        expected.error =
+            "Could not parse msgpack: The input is truncated or malformed.";
+      }
+      return expected;
+    }
+  }
+  return expected;
+}
+
+std::vector<Key> make_keys(std::mt19937* _rng, const size_t _n) {
+  // Few names, so there are plenty of duplicates.
+  const char* names[] = {"a", "b", "type", "name", "id", "value", "x", "y"};
+  auto keys = std::vector<Key>();
+  for (size_t i = 0; i < _n; ++i) {
+    if ((*_rng)() % 20 == 0) {
+      keys.push_back(Key{});
+    } else if ((*_rng)() % 2 == 0) {
+      keys.push_back(Key{names[(*_rng)() % std::size(names)]});
+    } else {
+      keys.push_back(Key{"f" + std::to_string(i)});
+    }
+  }
+  return keys;
+}
+
+const std::vector<std::string> lookups = {"a",  "type", "value", "y",
+                                          "f3", "f17",  "f30",   "missing"};
+
+TEST(msgpack, test_key_index_reader) {
+  // Maps below and above the size from which on an index is built must
+  // behave like a linear scan.
+  auto rng = std::mt19937(5);
+  for (int iteration = 0; iteration < 300; ++iteration) {
+    const auto keys = make_keys(&rng, rng() % 40);
+    std::vector<size_t> key_ends, value_ends;
+    const auto bytes = encode(keys, &key_ends, &value_ends);
+
+    msgpack_zone zone;
+    msgpack_zone_init(&zone, 2048);
+    msgpack_object deserialized;
+    ASSERT_EQ(msgpack_unpack(bytes.data(), bytes.size(), nullptr, &zone,
+                             &deserialized),
+              MSGPACK_UNPACK_SUCCESS);
+
+    const auto r = rfl::msgpack::Reader();
+    const auto obj = r.to_object(deserialized).value();
+    // Looking up several names in the same object reuses its index.
+    for (const auto& name : lookups) {
+      const auto expected =
+          scan(keys, key_ends, value_ends, bytes.size(), name);
+      const auto res = r.get_field_from_object(name, obj);
+      if (expected.pos) {
+        ASSERT_TRUE(res) << res.error().what();
+        EXPECT_EQ(r.to_basic_type<size_t>(*res).value(), *expected.pos);
+      } else {
+        ASSERT_FALSE(res) << name;
+        EXPECT_EQ(res.error().what(), expected.error);
+      }
+      EXPECT_EQ(r.has_field(name, obj), expected.has_field) << name;
+    }
+    msgpack_zone_destroy(&zone);
+  }
+}
+
+TEST(msgpack, test_key_index_on_demand) {
+  auto rng = std::mt19937(7);
+  for (int iteration = 0; iteration < 300; ++iteration) {
+    const auto keys = make_keys(&rng, rng() % 40);
+    std::vector<size_t> key_ends, value_ends;
+    const auto bytes = encode(keys, &key_ends, &value_ends);
+
+    // Truncated input must stop the lookups where a linear scan would stop.
+    const auto size =
+        rng() % 3 == 0 ? 3 + rng() % (bytes.size() - 2) : bytes.size();
+    const auto r = rfl::msgpack::OnDemandReader(bytes.data() + size);
+    const auto obj =
+        r.to_object(rfl::msgpack::OnDemandReader::InputVarType(bytes.data()))
+            .value();
+    for (const auto& name : lookups) {
+      const auto expected = scan(keys, key_ends, value_ends, size, name);
+      const auto res = r.get_field_from_object(name, obj);
+      if (expected.pos) {
+        ASSERT_TRUE(res) << res.error().what();
+        // Like the linear scan, the lookup does not check the value itself.
+        const auto val = r.to_basic_type<size_t>(*res);
+        EXPECT_EQ(static_cast<bool>(val), value_ends[*expected.pos] <= size);
+        if (val) {
+          EXPECT_EQ(*val, *expected.pos);
+        }
+      } else {
+        ASSERT_FALSE(res) << name;
+        EXPECT_EQ(res.error().what(), expected.error);
+      }
+      EXPECT_EQ(r.has_field(name, obj), expected.has_field) << name;
+    }
+  }
+}
+
+struct Small {
+  std::string a;
+  int b;
+};
+
+/// Has more than enough fields for its maps to be indexed.
+struct Large {
+  int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15,
+      f16, f17;
+  std::string a;
+};
+
+struct LargeWithC {
+  int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15,
+      f16, f17;
+  std::string c;
+};
+
+TEST(msgpack, test_key_index_variants) {
+  // The untagged variant checks each alternative for its required fields
+  // and the tagged union looks up the discriminator, both through the index.
+  using Variant = std::variant<Small, LargeWithC, Large>;
+  const auto large = Large{.f17 = 17, .a = "large"};
+  const auto bytes = rfl::msgpack::write(large);
+  for (const auto& res : {rfl::msgpack::read<Variant>(bytes),
+                          rfl::msgpack::read<Variant,
+                                             rfl::msgpack::OnDemand>(bytes)}) {
+    ASSERT_TRUE(res) << res.error().what();
+    ASSERT_EQ(res->index(), 2u);
+    EXPECT_EQ(std::get<2>(*res).f17, 17);
+    EXPECT_EQ(std::get<2>(*res).a, "large");
+  }
+
+  using Tagged = rfl::TaggedUnion<"type", Small, Large>;
+  const auto tagged_bytes = rfl::msgpack::write(Tagged(large));
+  for (const auto& res :
+       {rfl::msgpack::read<Tagged>(tagged_bytes),
+        rfl::msgpack::read<Tagged, rfl::msgpack::OnDemand>(tagged_bytes)}) {
+    ASSERT_TRUE(res) << res.error().what();
+    EXPECT_EQ(res->variant().index(), 1u);
+  }
+}
+
+}  // namespace test_key_index
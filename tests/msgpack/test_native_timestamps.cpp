@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+#include "../shared/native_timestamps.hpp"
+
+namespace test_native_timestamps {
+
+struct Msgpack {
+  template <class... Ps>
+  static auto write(const Event& _event) {
+    return rfl::msgpack::write<Ps...>(_event);
+  }
+
+  template <class T, class... Ps>
+  static auto read(const std::vector<char>& _bytes) {
+    return rfl::msgpack::read<T, Ps...>(_bytes);
+  }
+};
+
+TEST(msgpack, test_native_timestamps) {
+  // Covers all three widths of extension type -1: 32 bit seconds, 34 bit
+  // seconds and 64 bit signed seconds, which is needed before 1970.
+  auto all_times = times();
+  all_times.push_back("2106-02-07 06:28:16");
+  for (const auto& time : all_times) {
+    expect_round_trip<Msgpack>(time, true);
+    expect_round_trip<Msgpack, rfl::msgpack::OnDemand>(time, true);
+  }
+}
+
+TEST(msgpack, test_native_timestamps_differ_from_strings) {
+  const auto event = Event{.name = "launch", .time = TS("2024-02-29 12:34:56")};
+  const auto native = rfl::msgpack::write<rfl::NativeTimestamps>(event);
+  const auto str = rfl::msgpack::write(event);
+  EXPECT_LT(native.size(), str.size());
+
+  const auto res = rfl::msgpack::read<Event>(str);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(res->time.str(), "2024-02-29 12:34:56");
+}
+
+}  // namespace test_native_timestamps
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+namespace test_on_demand {
+
+using OnDemand = rfl::msgpack::OnDemand;
+
+struct Nested {
+  std::int64_t x;
+  std::vector<std::int64_t> ys;
+};
+
+/// What is read. Everything else in Document must be skipped.
+struct Person {
+  std::string name;
+  std::int64_t id;
+  double score;
+  std::vector<std::string> tags;
+  Nested nested;
+  bool flag;
+  std::optional<std::string> nickname;
+};
+
+/// What is written.
+struct Document {
+  std::optional<rfl::Generic> junk;
+  std::string name;
+  std::int64_t id;
+  double score;
+  std::vector<std::string> tags;
+  Nested nested;
+  std::vector<Nested> more;
+  bool flag;
+  std::optional<std::string> nickname;
+};
+
+std::vector<std::vector<char>> make_corpus(const size_t _n) {
+  auto rng = std::mt19937(11);
+  const auto integer = [&]() -> std::int64_t {
+    const std::int64_t edges[] = {0,      1,         -1,           127,
+                                  128,    -32,       -33,          255,
+                                  256,    -128,      -129,         65535,
+                                  65536,  -32768,    -32769,       1LL << 31,
+                                  -(1LL << 31),      1LL << 40};
+    return rng() % 2 ? edges[rng() % std::size(edges)]
+                     : static_cast<std::int64_t>(rng()) - (1LL << 31);
+  };
+  const auto string = [&]() {
+    const size_t lengths[] = {0, 1, 5, 31, 32, 40, 300};
+    return std::string(lengths[rng() % std::size(lengths)],
+                       "ab\"\\ \xc3\xa9"[rng() % 7]);
+  };
+  auto corpus = std::vector<std::vector<char>>();
+  for (size_t i = 0; i < _n; ++i) {
+    auto doc = Document{.name = string(),
+                        .id = integer(),
+                        .score = static_cast<double>(integer()) / 3.0,
+                        .tags = std::vector<std::string>(rng() % 5, string()),
+                        .nested = Nested{.x = integer(),
+                                         .ys = std::vector<std::int64_t>(
+                                             rng() % 20, integer())},
+                        .more = std::vector<Nested>(rng() % 3),
+                        .flag = rng() % 2 == 0};
+    if (rng() % 2) {
+      auto junk = rfl::Generic::Object();
+      junk["a"] = rfl::Generic::Array{rfl::Generic(integer()),
+                                      rfl::Generic(2.5), rfl::Generic()};
+      junk["b"] = string();
+      doc.junk = junk;
+    }
+    if (rng() % 2) {
+      doc.nickname = string();
+    }
+    corpus.push_back(rfl::msgpack::write(doc));
+  }
+  return corpus;
+}
+
+/// Both readers must agree on whether _bytes can be read as T and, if they
+/// can, on what they read.
+template <class T>
+void expect_same(const std::vector<char>& _bytes) {
+  const auto expected = rfl::msgpack::read<T>(_bytes);
+  const auto actual = rfl::msgpack::read<T, OnDemand>(_bytes);
+  ASSERT_EQ(static_cast<bool>(expected), static_cast<bool>(actual));
+  if (expected) {
+    ASSERT_EQ(rfl::msgpack::write(*expected), rfl::msgpack::write(*actual));
+  }
+}
+
+TEST(msgpack, test_on_demand) {
+  auto rng = std::mt19937(13);
+  for (const auto& bytes : make_corpus(300)) {
+    expect_same<Person>(bytes);
+    expect_same<Document>(bytes);
+    expect_same<rfl::Generic>(bytes);
+
+    for (int i = 0; i < 10; ++i) {
+      auto truncated = bytes;
+      truncated.resize(rng() % bytes.size());
+      EXPECT_FALSE((rfl::msgpack::read<Person, OnDemand>(truncated)));
+      expect_same<Person>(truncated);
+
+      auto corrupted = bytes;
+      corrupted[rng() % corrupted.size()] = static_cast<char>(rng());
+      expect_same<Person>(corrupted);
+      expect_same<rfl::Generic>(corrupted);
+    }
+    if (::testing::Test::HasFatalFailure()) {
+      return;
+    }
+  }
+}
+
+TEST(msgpack, test_on_demand_deeply_nested) {
+  // [[[...[nil]...]]], which must not overflow the stack when it is skipped.
+  auto bytes = std::vector<char>(1000000, '\x91');
+  bytes.push_back('\xc0');
+  const auto res = rfl::msgpack::read<Nested, OnDemand>(bytes);
+  ASSERT_FALSE(res);
+  EXPECT_EQ(std::string(res.error().what()), "Could not cast to a map.");
+}
+
+}  // namespace test_on_demand
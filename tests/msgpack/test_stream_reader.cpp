@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+namespace test_stream_reader {
+
+struct Message {
+  std::string text;
+  int id;
+};
+
+std::vector<char> make_stream(const size_t _n) {
+  auto stream = std::vector<char>();
+  for (size_t i = 0; i < _n; ++i) {
+    rfl::msgpack::write_to(
+        Message{.text = "message " + std::to_string(i),
+                .id = static_cast<int>(i)},
+        stream);
+  }
+  return stream;
+}
+
+/// Feeds _stream in chunks of _chunk_size bytes and collects every message
+/// as soon as it is complete.
+std::vector<Message> read_in_chunks(const std::vector<char>& _stream,
+                                    const size_t _chunk_size,
+                                    rfl::msgpack::StreamReader<Message>* _r) {
+  auto messages = std::vector<Message>();
+  for (size_t i = 0; i < _stream.size(); i += _chunk_size) {
+    const auto size = std::min(_chunk_size, _stream.size() - i);
+    EXPECT_TRUE(_r->feed(_stream.data() + i, size));
+    while (const auto res = _r->next()) {
+      EXPECT_TRUE(*res) << res->error().what();
+      if (*res) {
+        messages.push_back(res->value());
+      }
+    }
+  }
+  return messages;
+}
+
+TEST(msgpack, test_stream_reader) {
+  const auto stream = make_stream(100);
+
+  for (const size_t chunk_size : {size_t(1), size_t(7), size_t(4096)}) {
+    auto r = rfl::msgpack::StreamReader<Message>();
+    const auto messages = read_in_chunks(stream, chunk_size, &r);
+    ASSERT_EQ(messages.size(), 100u);
+    for (size_t i = 0; i < messages.size(); ++i) {
+      EXPECT_EQ(messages[i].text, "message " + std::to_string(i));
+      EXPECT_EQ(messages[i].id, static_cast<int>(i));
+    }
+    EXPECT_EQ(r.num_messages(), 100u);
+    EXPECT_TRUE(r.finish());
+  }
+}
+
+TEST(msgpack, test_stream_reader_large_messages) {
+  // Messages much larger than the initial buffer, whose strings point into
+  // the buffer while it has to grow.
+  auto stream = std::vector<char>();
+  for (size_t i = 0; i < 20; ++i) {
+    rfl::msgpack::write_to(
+        Message{.text = std::string(1000 * i * i, static_cast<char>('a' + i)),
+                .id = static_cast<int>(i)},
+        stream);
+  }
+  for (const size_t chunk_size : {size_t(100), size_t(70000)}) {
+    auto r = rfl::msgpack::StreamReader<Message>(64);
+    const auto messages = read_in_chunks(stream, chunk_size, &r);
+    ASSERT_EQ(messages.size(), 20u);
+    for (size_t i = 0; i < messages.size(); ++i) {
+      EXPECT_EQ(messages[i].text,
+                std::string(1000 * i * i, static_cast<char>('a' + i)));
+      EXPECT_EQ(messages[i].id, static_cast<int>(i));
+    }
+    EXPECT_TRUE(r.finish());
+  }
+}
+
+TEST(msgpack, test_stream_reader_truncated) {
+  auto stream = make_stream(3);
+  stream.pop_back();
+
+  auto r = rfl::msgpack::StreamReader<Message>();
+  const auto messages = read_in_chunks(stream, 5, &r);
+  EXPECT_EQ(messages.size(), 2u);
+
+  const auto res = r.finish();
+  ASSERT_FALSE(res);
+  EXPECT_EQ(res.error().what(),
+            "Message 2: The stream ended in the middle of a message.");
+}
+
+TEST(msgpack, test_stream_reader_wrong_type) {
+  auto stream = make_stream(1);
+  rfl::msgpack::write_to(std::vector<int>{1, 2, 3}, stream);
+  const auto last = make_stream(1);
+  stream.insert(stream.end(), last.begin(), last.end());
+
+  auto r = rfl::msgpack::StreamReader<Message>();
+  ASSERT_TRUE(r.feed(stream.data(), stream.size()));
+
+  EXPECT_TRUE(*r.next());
+  const auto wrong = r.next();
+  ASSERT_TRUE(wrong);
+  EXPECT_FALSE(*wrong);
+
+  // A message that does not match Message does not end the stream.
+  EXPECT_TRUE(*r.next());
+  EXPECT_FALSE(r.next());
+  EXPECT_TRUE(r.finish());
+}
+
+TEST(msgpack, test_stream_reader_garbage) {
+  auto stream = make_stream(1);
+  // 0xc1 is never used in msgpack.
+  stream.push_back('\xc1');
+  const auto last = make_stream(1);
+  stream.insert(stream.end(), last.begin(), last.end());
+
+  auto r = rfl::msgpack::StreamReader<Message>();
+  ASSERT_TRUE(r.feed(stream.data(), stream.size()));
+
+  EXPECT_TRUE(*r.next());
+  const auto garbage = r.next();
+  ASSERT_TRUE(garbage);
+  ASSERT_FALSE(*garbage);
+  EXPECT_EQ(garbage->error().what(),
+            "Message 1: Could not parse msgpack: The input is malformed.");
+
+  // Malformed msgpack cannot be recovered from.
+  EXPECT_FALSE(r.next());
+  EXPECT_FALSE(r.feed(stream.data(), stream.size()));
+  EXPECT_FALSE(r.finish());
+}
+
+}  // namespace test_stream_reader
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <rfl/msgpack/StreamSink.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_stream_sink {
+
+using StreamSink = rfl::msgpack::StreamSink;
+
+/// Counts how often the sink writes to the stream.
+class CountingBuf : public std::stringbuf {
+ public:
+  size_t num_writes() const { return num_writes_; }
+
+ protected:
+  std::streamsize xsputn(const char* _s, std::streamsize _n) override {
+    ++num_writes_;
+    return std::stringbuf::xsputn(_s, _n);
+  }
+
+ private:
+  size_t num_writes_ = 0;
+};
+
+/// Passes _writes to the sink like msgpack_packer would and checks that the
+/// stream receives exactly their concatenation.
+void expect_same_bytes(const std::vector<std::string>& _writes) {
+  auto buf = CountingBuf();
+  auto stream = std::ostream(&buf);
+  auto sink = StreamSink(&stream);
+  std::string expected;
+  for (const auto& w : _writes) {
+    ASSERT_EQ(StreamSink::write(&sink, w.data(), w.size()), 0);
+    expected += w;
+  }
+  sink.flush();
+  EXPECT_EQ(buf.str(), expected);
+
+  // Small writes are collected in chunks of 4 KiB, larger ones are passed on
+  // directly, so there are never more stream writes than there would be if
+  // every chunk was full, plus one for every large write.
+  size_t num_large = 0;
+  for (const auto& w : _writes) {
+    num_large += w.size() >= 4096 ? 1 : 0;
+  }
+  EXPECT_LE(buf.num_writes(), 2 * (expected.size() / 4096 + num_large) + 1);
+}
+
+TEST(msgpack, test_stream_sink) {
+  // Many small writes, which fill the buffer several times.
+  auto small = std::vector<std::string>();
+  for (int i = 0; i < 5000; ++i) {
+    small.push_back(std::string(1 + i % 9, static_cast<char>('a' + i % 26)));
+  }
+  expect_same_bytes(small);
+
+  // Writes of at least 4 KiB, which bypass the buffer, on their own and
+  // with the buffer partly filled.
+  for (const size_t size : {4095, 4096, 4097, 100000}) {
+    expect_same_bytes({std::string(size, 'x')});
+    expect_same_bytes({"before", std::string(size, 'x'), "after"});
+  }
+  expect_same_bytes({std::string(3000, 'a'), std::string(5000, 'b'), "c",
+                     std::string(4096, 'd'), std::string(10, 'e')});
+  expect_same_bytes({});
+  expect_same_bytes({""});
+
+  auto rng = std::mt19937(3);
+  for (int i = 0; i < 20; ++i) {
+    auto writes = std::vector<std::string>();
+    for (int j = 0; j < 200; ++j) {
+      const auto size = rng() % 4 == 0 ? rng() % 10000 : rng() % 20;
+      writes.push_back(std::string(size, static_cast<char>(rng())));
+    }
+    expect_same_bytes(writes);
+  }
+}
+
+TEST(msgpack, test_stream_sink_nothing_before_flush) {
+  auto buf = CountingBuf();
+  auto stream = std::ostream(&buf);
+  auto sink = StreamSink(&stream);
+  const auto bytes = std::string(4000, 'x');
+  ASSERT_EQ(StreamSink::write(&sink, bytes.data(), bytes.size()), 0);
+  EXPECT_EQ(buf.num_writes(), 0u);
+  sink.flush();
+  EXPECT_EQ(buf.num_writes(), 1u);
+  EXPECT_EQ(buf.str(), bytes);
+}
+
+TEST(msgpack, test_stream_sink_bad_stream) {
+  // The packer stops as soon as write returns a non-zero value.
+  auto stream = std::ostringstream();
+  stream.setstate(std::ios::badbit);
+  auto sink = StreamSink(&stream);
+  const auto bytes = std::string(5000, 'x');
+  EXPECT_EQ(StreamSink::write(&sink, bytes.data(), bytes.size()), -1);
+}
+
+}  // namespace test_stream_sink
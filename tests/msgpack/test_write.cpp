@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_write {
+
+struct Message {
+  std::string text;
+  std::vector<std::string> parts;
+};
+
+/// Writing to a stream goes through the StreamSink, which must produce
+/// exactly the same bytes as writing to a vector.
+void expect_same_bytes(const Message& _msg) {
+  const auto expected = rfl::msgpack::write(_msg);
+
+  auto stream = std::ostringstream();
+  rfl::msgpack::write(_msg, stream);
+  const auto str = stream.str();
+  const auto actual = std::vector<char>(str.begin(), str.end());
+
+  ASSERT_EQ(actual.size(), expected.size());
+  EXPECT_EQ(actual, expected);
+  EXPECT_EQ(rfl::msgpack::packed_size(_msg), expected.size());
+
+  const auto res = rfl::msgpack::read<Message>(actual);
+  ASSERT_TRUE(res) << res.error().what();
+  EXPECT_EQ(res->text, _msg.text);
+  EXPECT_EQ(res->parts, _msg.parts);
+}
+
+TEST(msgpack, test_write_stream) {
+  // Many small writes, which fill the 4 KiB buffer several times.
+  auto parts = std::vector<std::string>();
+  for (int i = 0; i < 2000; ++i) {
+    parts.push_back("part " + std::to_string(i));
+  }
+  expect_same_bytes(Message{.text = "many parts", .parts = parts});
+
+  // Writes of at least 4 KiB, which bypass the buffer.
+  for (const size_t size : {4095, 4096, 4097, 100000}) {
+    expect_same_bytes(
+        Message{.text = std::string(size, 'x'), .parts = {"before", "after"}});
+  }
+
+  // Large writes following small ones, with the buffer partly filled.
+  expect_same_bytes(Message{
+      .text = "small",
+      .parts = {std::string(3000, 'a'), std::string(5000, 'b'), "c",
+                std::string(4096, 'd'), std::string(10, 'e')}});
+}
+
+}  // namespace test_write
@@ -0,0 +1,50 @@
+#ifndef TESTS_SHARED_NATIVE_TIMESTAMPS_HPP_
+#define TESTS_SHARED_NATIVE_TIMESTAMPS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <string>
+#include <vector>
+
+namespace test_native_timestamps {
+
+using TS = rfl::Timestamp<"%Y-%m-%d %H:%M:%S">;
+
+struct Event {
+  std::string name;
+  TS time;
+};
+
+/// Times on both sides of the epoch, because the binary formats count from
+/// there and the values are negative before 1970.
+inline std::vector<std::string> times() {
+  return {"1970-01-01 00:00:00", "2024-02-29 12:34:56", "2500-01-01 00:00:00",
+          "1969-07-20 20:17:40", "1900-01-01 00:00:00"};
+}
+
+/// Writes an event with rfl::NativeTimestamps and reads it back through
+/// Format, which wraps the write and read functions of one format. If
+/// _reject_without_processor is set, reading the bytes without
+/// rfl::NativeTimestamps must fail, because a string is expected.
+template <class Format, class... Ps>
+void expect_round_trip(const std::string& _time,
+                       const bool _reject_without_processor) {
+  const auto event = Event{.name = "launch", .time = TS(_time)};
+  const auto bytes = Format::template write<rfl::NativeTimestamps>(event);
+
+  const auto res =
+      Format::template read<Event, rfl::NativeTimestamps, Ps...>(bytes);
+  ASSERT_TRUE(res) << _time << ": " << res.error().what();
+  EXPECT_EQ(res->name, event.name);
+  EXPECT_EQ(res->time.str(), _time);
+  EXPECT_EQ(res->time.time_point(), event.time.time_point());
+
+  if (_reject_without_processor) {
+    EXPECT_FALSE((Format::template read<Event, Ps...>(bytes))) << _time;
+  }
+}
+
+}  // namespace test_native_timestamps
+
+#endif